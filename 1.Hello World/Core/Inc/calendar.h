@@ -0,0 +1,42 @@
+/*
+ * calendar.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ */
+
+#ifndef INC_CALENDAR_H_
+#define INC_CALENDAR_H_
+
+#include "main.h"
+
+/*
+ * Calendar calculations shared by the RTC, charts, sample log and DST code.
+ * Days and epoch seconds are counted from 2000-01-01 00:00, the first date the RTC can hold.
+ */
+#define CAL_EPOCH_YEAR		2000
+#define CAL_SECONDS_PER_DAY	86400
+
+/*
+ * Day of the week, the same numbering as the RTC WeekDay field set by LT_SetTime()
+ */
+typedef enum
+{
+  CAL_MONDAY = 0,
+  CAL_TUESDAY,
+  CAL_WEDNESDAY,
+  CAL_THURSDAY,
+  CAL_FRIDAY,
+  CAL_SATURDAY,
+  CAL_SUNDAY
+} CAL_WeekDay_t;
+
+uint8_t CAL_IsLeapYear (uint16_t year);
+uint8_t CAL_DaysInMonth (uint16_t year, uint8_t month);
+uint32_t CAL_DaysFromCivil (uint16_t year, uint8_t month, uint8_t day);
+void CAL_CivilFromDays (uint32_t days, uint16_t* year, uint8_t* month, uint8_t* day);
+CAL_WeekDay_t CAL_WeekDay (uint32_t days);
+uint8_t CAL_LastSunday (uint16_t year, uint8_t month);
+uint32_t RTC_ToEpochSeconds (RTC_TimeTypeDef* time, RTC_DateTypeDef* date);
+
+#endif /* INC_CALENDAR_H_ */
@@ -1,31 +1,44 @@
-
-/*
- * charts.h
- *
- *  Created on: Dec 21, 2024
- *      Author: piotr
- */
-
-#ifndef INC_CHARTS_H_
-#define INC_CHARTS_H_
-
-#include "main.h"
-#include "epdpaint.h"
-#include "ui.h"
-#include "rtc.h"
-
-typedef struct
-{
-    uint32_t  epoch_seconds; 	// 4 bytes
-    float temperature;		// 4 bytes
-    float humidity;		// 4 byte
-    float pressure;		// 4 byte
-    float battery_level;	// 4 byte
-    uint8_t padding[12];	// padding do 32 bytes
-}CHARTS_t;
-
-void CHARTS_DrawCharts (Paint* paint, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef sTime, RTC_DateTypeDef sDate);
-void CHARTS_SaveData (CHARTS_t* data);
-uint32_t RTC_ToEpochSeconds(RTC_TimeTypeDef* time, RTC_DateTypeDef* date);
-
-#endif /* INC_CHARTS_H_ */
+
+/*
+ * charts.h
+ *
+ *  Created on: Dec 21, 2024
+ *      Author: piotr
+ */
+
+#ifndef INC_CHARTS_H_
+#define INC_CHARTS_H_
+
+#include "main.h"
+#include "epdpaint.h"
+#include "ui.h"
+#include "rtc.h"
+
+typedef struct
+{
+    uint32_t  epoch_seconds; 	// 4 bytes
+    float temperature;		// 4 bytes
+    float humidity;		// 4 byte
+    float pressure;		// 4 byte
+    float battery_level;	// 4 byte
+    uint8_t padding[12];	// padding do 32 bytes
+}CHARTS_t;
+
+/*
+ * Location of a cached CHARTS screen in the flash. The frame is split over two
+ * sectors, the parts are sent to the display one after another.
+ */
+#define CHARTS_FRAME_PARTS 2
+
+typedef struct
+{
+    uint32_t address[CHARTS_FRAME_PARTS];
+    uint32_t length[CHARTS_FRAME_PARTS];
+} CHARTS_FrameParts_t;
+
+void CHARTS_DrawCharts (Paint* paint, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef sTime, RTC_DateTypeDef sDate);
+void CHARTS_SaveData (CHARTS_t* data);
+uint8_t CHARTS_FindFrame (CHARTS_FrameParts_t* parts, uint32_t size, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef sTime, RTC_DateTypeDef sDate);
+void CHARTS_StoreFrame (const unsigned char* frame, uint32_t size, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef sTime, RTC_DateTypeDef sDate);
+
+#endif /* INC_CHARTS_H_ */
@@ -0,0 +1,53 @@
+/*
+ * ftl.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ */
+
+#ifndef INC_FTL_H_
+#define INC_FTL_H_
+
+#include "main.h"
+
+/*
+ * Flash translation layer for data rewritten in place (cached chart frames, settings).
+ * Logical sectors are mapped to physical 4 KB sectors of the partition. Every write of
+ * a logical sector goes to a free physical sector, so no sector is erased more often
+ * than the others. The sample log has its own ring and doesn't use this layer.
+ */
+#define FTL_START_ADDRESS	0x800000   // Right after the sample log partition
+#define FTL_PHYSICAL_SECTORS	256        // 1 MB of physical sectors
+#define FTL_LOGICAL_SECTORS	64         // Logical sectors, the rest is spare room for the levelling
+#define FTL_SECTOR_SIZE		0x1000     // Physical sector size: 4 KB
+#define FTL_SECTOR_MAGIC	0x314C5446 // "FTL1"
+#ifndef FTL_STATIC_THRESHOLD
+#define FTL_STATIC_THRESHOLD	64         // Erase count spread that moves cold data to worn sectors
+#endif
+
+/*
+ * Header at the beginning of every physical sector. The erase count and the mapping are
+ * programmed right after the erase, the magic number after the data: a sector is only
+ * used once the magic is set, but its erase count survives an interrupted write.
+ */
+typedef struct
+{
+    uint32_t eraseCount;	// Number of erases of this physical sector
+    uint32_t version;		// Incremented for every write, the newest copy of a logical sector wins
+    uint16_t logical;		// Logical sector stored here
+    uint16_t check;		// Check of the fields above, rejects a header garbled by an interrupted erase
+    uint32_t magic;		// FTL_SECTOR_MAGIC once the data is complete
+} FTL_SectorHeader_t;
+
+#define FTL_DATA_SIZE		(FTL_SECTOR_SIZE - sizeof(FTL_SectorHeader_t)) // Payload of a logical sector
+
+uint8_t FTL_Mount (void);
+uint8_t FTL_BeginWrite (uint16_t logical);
+uint8_t FTL_WriteData (const void* data, uint32_t size);
+uint8_t FTL_EndWrite (void);
+uint8_t FTL_Write (uint16_t logical, const void* data, uint32_t size);
+uint8_t FTL_Read (uint16_t logical, uint32_t offset, void* data, uint32_t size);
+uint8_t FTL_GetDataAddress (uint16_t logical, uint32_t* address);
+uint8_t FTL_GetEraseCountRange (uint32_t* minCount, uint32_t* maxCount);
+
+#endif /* INC_FTL_H_ */
@@ -0,0 +1,62 @@
+/*
+ * kv_store.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ */
+
+#ifndef INC_KV_STORE_H_
+#define INC_KV_STORE_H_
+
+#include "main.h"
+
+/*
+ * Log-structured key-value store for small persistent data: settings, calibration,
+ * time zone rules, statistics. Entries are appended to the active sector of a small ring,
+ * a full sector is compacted into the next one. Values are kept in RAM after the mount,
+ * so reads never access the flash.
+ */
+#define KV_START_ADDRESS	0x900000   // Right after the flash translation layer
+#define KV_SECTOR_COUNT		4          // Sectors of the ring, one of them is active
+#define KV_SECTOR_SIZE		0x1000     // Sector size: 4 KB
+#define KV_SECTOR_MAGIC		0x3156564B // "KVV1"
+#define KV_MAX_KEYS		24         // Keys held at the same time
+#define KV_MAX_VALUE_SIZE	16         // Bytes of a single value
+
+/*
+ * Keys of the stored values. New keys are added at the end, a stored key is never renumbered.
+ */
+typedef enum
+{
+  KV_KEY_UI_SETTINGS = 1,              // Copy of the UI settings backup register
+} KV_Key_t;
+
+/*
+ * Header at the beginning of every sector. The magic number is programmed after
+ * the entries copied by a compaction, so an interrupted compaction leaves the previous
+ * sector active.
+ */
+typedef struct
+{
+    uint32_t magic;		// KV_SECTOR_MAGIC once the sector is complete
+    uint32_t sequence;		// Incremented for every compaction, the highest one is active
+    uint32_t check;		// Inverted sequence, rejects a header garbled by an interrupted erase
+} KV_SectorHeader_t;
+
+/*
+ * Header of an entry, followed by the value padded to 4 bytes.
+ * An entry with no value deletes the key.
+ */
+typedef struct
+{
+    uint16_t key;		// 0xFFFF marks the free space at the end of the sector
+    uint8_t length;		// Length of the value
+    uint8_t check;		// Check of the key, length and value
+} KV_EntryHeader_t;
+
+uint8_t KV_Mount (void);
+uint8_t KV_Get (uint16_t key, void* value, uint8_t size);
+uint8_t KV_Set (uint16_t key, const void* value, uint8_t length);
+uint8_t KV_Delete (uint16_t key);
+
+#endif /* INC_KV_STORE_H_ */
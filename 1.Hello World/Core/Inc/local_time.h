@@ -1,14 +1,14 @@
-/*
- * local_time.h
- *
- *  Created on: Jul 15, 2024
- *      Author: piotr
- */
-
-#ifndef INC_LOCAL_TIME_H_
-#define INC_LOCAL_TIME_H_
-
-#include "NEO_6m.h"
-void LT_SetTime (RTC_HandleTypeDef *hrtc, DateTime *time);
-
-#endif /* INC_LOCAL_TIME_H_ */
+/*
+ * local_time.h
+ *
+ *  Created on: Jul 15, 2024
+ *      Author: piotr
+ */
+
+#ifndef INC_LOCAL_TIME_H_
+#define INC_LOCAL_TIME_H_
+
+#include "NEO_6m.h"
+void LT_SetTime (RTC_HandleTypeDef *hrtc, DateTime *time);
+
+#endif /* INC_LOCAL_TIME_H_ */
@@ -0,0 +1,82 @@
+/*
+ * sample_log.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ */
+
+#ifndef INC_SAMPLE_LOG_H_
+#define INC_SAMPLE_LOG_H_
+
+#include "main.h"
+#include "charts.h"
+
+/*
+ * Append-only log of CHARTS_t records kept in the external flash.
+ * Every 4 KB sector starts with a header (magic, sequence number, first record
+ * of the sector), followed by a bit stream of compressed records in write order
+ * and a footer summarizing the records once the sector is full.
+ * The newest sector is found at mount time from the headers, so no separate
+ * pointer sector is needed and a regular save is a single page program.
+ * The number of sectors in the ring is set at mount time from the size of the chip.
+ * Appended records wait in the RTC backup registers and reach the flash in bursts.
+ */
+#define SLOG_START_ADDRESS		0x000000   // First sector of the log
+#define SLOG_PARTITION_SIZE		0x800000   // Space reserved for the log: 8 MB, limited to the detected chip size
+#define SLOG_SECTOR_SIZE		0x1000     // Sector size: 4 KB
+#define SLOG_VALUE_COUNT		4          // Temperature, humidity, pressure, battery level
+#define SLOG_SECTOR_MAGIC		0x32474C53 // "SLG2", compressed sectors
+
+typedef struct
+{
+    uint32_t magic;		// SLOG_SECTOR_MAGIC when the sector belongs to the log
+    uint32_t sequence;		// Incremented for every newly opened sector
+    uint32_t first_epoch;	// Epoch seconds of the first record in the sector
+    int32_t first_values[SLOG_VALUE_COUNT]; // Fixed point values of the first record
+    uint8_t padding[4];		// padding to 32 bytes
+} SLOG_SectorHeader_t;
+
+/*
+ * Summary written at the end of a sector when it is full. Values are in fixed point,
+ * sums fit into 32 bits for any number of records a sector can hold.
+ */
+typedef struct
+{
+    uint32_t count;		// Number of records in the sector
+    uint32_t last_epoch;	// Epoch seconds of the last record in the sector
+    int32_t min[SLOG_VALUE_COUNT];
+    int32_t max[SLOG_VALUE_COUNT];
+    int32_t sum[SLOG_VALUE_COUNT];
+    uint32_t magic;		// Written last, set when the footer is complete
+    uint8_t padding[4];		// padding to 64 bytes
+} SLOG_SectorFooter_t;
+
+/*
+ * Statistics of the records within a time range. Values are indexed in the order
+ * temperature, humidity, pressure, battery level, the same as the chart types.
+ */
+typedef struct
+{
+    uint32_t count;
+    float min[SLOG_VALUE_COUNT];
+    float max[SLOG_VALUE_COUNT];
+    float mean[SLOG_VALUE_COUNT];
+} SLOG_Stats_t;
+
+/*
+ * Callback invoked for every record returned by a range query.
+ * Records are delivered in write order (oldest first).
+ */
+typedef void (*SLOG_RecordCallback_t) (const CHARTS_t* record, void* context);
+
+void SLOG_Mount (void);
+void SLOG_Append (CHARTS_t* record);
+void SLOG_Flush (void);
+void SLOG_ClearQueue (void);
+uint32_t SLOG_GetRecordNumber (void);
+uint32_t SLOG_ReadRange (uint32_t startEpoch, uint32_t endEpoch, SLOG_RecordCallback_t callback, void* context);
+uint32_t SLOG_GetStats (uint32_t startEpoch, uint32_t endEpoch, SLOG_Stats_t* stats);
+uint8_t SLOG_GetSequenceRange (uint32_t* oldestSequence, uint32_t* newestSequence);
+uint8_t SLOG_GetSectorAddress (uint32_t sequence, uint32_t* address);
+
+#endif /* INC_SAMPLE_LOG_H_ */
@@ -5,8 +5,8 @@
  * @version V.1.0.0
  * 
  *********************************************
- * this version of library uses just polling 
- * mode transmission
+ * this version of library uses polling or mixed
+ * polling/DMA mode transmission
  * this version of library uses standard SPI
  *********************************************
  * configure below STEP1 and STEP4.
@@ -46,8 +46,8 @@
  *** enable SPI mode want, uncommenting ONE row ****
  **** (Setup the same configuration on CubeMX) *****
  ***************************************************/
-#define EXT_FLASH_SPI_POLLING_MODE
-//#define EXT_FLASH_SPI_DMA_MODE // (mixed: polling/DMA, see below) NOT IMPLEMENTED
+//#define EXT_FLASH_SPI_POLLING_MODE
+#define EXT_FLASH_SPI_DMA_MODE // (mixed: polling/DMA, see below) needs SPI RX and TX DMA streams on CubeMX
 
 
 
@@ -99,7 +99,13 @@
 
 
 
-#define EXT_FLASH_DMA_CUTOFF	20			//that's related to uC DMA and SPI. You can leave it unchanged
+#define EXT_FLASH_DMA_CUTOFF	20			//transfers shorter than this are sent in polling mode. You can leave it unchanged
+
+#define EXT_FLASH_IDLE_POWERDOWN	20		//ms without commands before Flash_Process() puts the chip in powerDown, 0 to disable it
+#define EXT_FLASH_CACHE_SETS		8		//RAM cache of 256b pages under Flash_Read(): sets x ways pages (4kB), 0 to disable it
+#define EXT_FLASH_CACHE_WAYS		2
+#define EXT_FLASH_CACHE_MAX_READ	64		//longer reads (bulk data) bypass the cache
+#define EXT_FLASH_JOB_QUEUE_SIZE	4		//erases queued by Flash_QueueSErase4k() and Flash_QueueChipErase(), waiting to be started by Flash_Process()
 
 /*|||||||| END OF USER/PROJECT PARAMETERS ||||||||*/
 
@@ -126,6 +132,8 @@
 #define W25_JEDEC_ID		0x9F
 #define W25_R_SR1			0x05
 #define W25_R_SFPD_REG		0x5A
+#define W25_EP_SUS	 		0x75	//suspends a running erase or program, chip is ready after tSUS (20us)
+#define W25_EP_RES	 		0x7A
 
 /* unused commands
 #define W25_SR_W_ENABLE		0x50
@@ -134,8 +142,6 @@
 #define W25_UNIQUE_ID		0x4B
 #define W25_FREAD_DUAL_IO	0xBB
 #define W25_FREAD_QUAD_IO	0xEB
-#define W25_EP_SUS	 		0x75
-#define W25_EP_RES	 		0x7A
 #define W25_W_SR1			0x01
 #define W25_R_SR2			0x35
 #define W25_W_SR2			0x31
@@ -157,6 +163,10 @@
 
 #define W25_DUMMY			0x00	//dummy MUST be 0x00, in "read manufacturer"
 
+// W25QXX timings
+#define W25_T_RES1_US		3		//release from powerDown to the next command
+#define W25_T_RST_US		30		//reset to the next command
+
 // bit masks of W25QXX SR1, SR2, SR3 registers
 #define SR1_BIT_BUSY		(01U)  //status only: 1 means busy device
 
@@ -196,7 +206,26 @@
 /*||||||||||| END OF DEVICE PARAMETERS ||||||||||||*/
 
 
+// counters of the powerDown management, see Flash_Select() and Flash_Process()
+typedef struct {
+	uint32_t wakeUps;		// releases from powerDown
+	uint32_t poweredTime;	// ms spent out of powerDown
+} FlashPowerStats;
+
+
+// port functions, weak: a host build can link a W25Q simulator in their place
+void 	 Flash_PortSetSelected(uint8_t selected);	//drives CS, 1 = chip selected
+uint8_t  Flash_PortIsSelected(void);
+void 	 Flash_PortTransmit(uint8_t* data, uint16_t dataSize);
+void 	 Flash_PortReceive(uint8_t* data, uint16_t dataSize);
+void 	 Flash_PortDelayUs(uint32_t us);
+
 void 	 Flash_Read(uint32_t addr, uint8_t* data, uint32_t dataSize);
+void 	 Flash_StartRead(uint32_t addr);
+void 	 Flash_ContinueRead(uint8_t* data, uint32_t dataSize);
+void 	 Flash_ContinueReadDMA(uint8_t* data, uint32_t dataSize);	//non blocking, data valid after Flash_WaitForDMA()
+void 	 Flash_WaitForDMA(void);
+void 	 Flash_EndRead();
 void 	 Flash_Write(uint32_t addr, uint8_t* data, uint32_t dataSize);
 //void 	 Flash_WaitForWritingComplete();
 void 	 Flash_SErase4k(uint32_t addr);
@@ -210,7 +239,16 @@ uint32_t Flash_ReadJedecID();
 void 	 Flash_ReadSFDP(uint8_t* data);
 void 	 Flash_Reset();
 uint8_t  Flash_Init();	//initialization: includes availability test and reset
-void 	 DataReader_WaitForReceiveDone();
+uint32_t Flash_GetSize();	//chip size in bytes, detected by Flash_Init()
+void 	 Flash_PowerUp();	//not needed: any command releases the chip from powerDown
+void 	 Flash_GetPowerStats(FlashPowerStats* stats);
+void 	 Flash_SetPowerStats(FlashPowerStats* stats);	//restores counters saved across an MCU standby
+void 	 Flash_GetCacheStats(uint32_t* hits, uint32_t* misses);
+uint8_t  Flash_QueueSErase4k(uint32_t addr);	//non blocking erase, 0 if the queue is full
+uint8_t  Flash_QueueChipErase();
+uint8_t  Flash_Process();	//to be called from the main loop: runs queued erases, 0 when there are no jobs left
+void 	 Flash_WaitForJobs();
+void 	 DataReader_WaitForReceiveDone();	//waits until a read started by DataReader_StartDMAReadData() ended
 void 	 DataReader_ReadData(uint32_t address24, uint8_t* buffer, uint32_t length);
 void 	 DataReader_StartDMAReadData(uint32_t address24, uint8_t* buffer, uint32_t length);
 
@@ -0,0 +1,136 @@
+/*
+ * calendar.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ *
+ *  This file converts between civil dates and day numbers in constant time.
+ *  Years are shifted to start in March, so the leap day is the last day of the year
+ *  and the length of every month except February follows a fixed 153 day pattern
+ *  over 5 months. Whole 400 year cycles have a fixed number of days as well,
+ *  so no loop over years or months is needed.
+ */
+
+#include "calendar.h"
+
+// ============================================================================
+// Definitions and Constants
+// ============================================================================
+
+#define CAL_DAYS_PER_ERA	146097     // Days in a 400 year cycle
+#define CAL_EPOCH_SHIFT		730425     // Days from 0000-03-01 to 2000-01-01
+
+/*
+ * Number of days in each month of a common year.
+ * Index: 0=Jan, 1=Feb, 2=Mar, etc.
+ */
+static const uint8_t daysInMonth[12] =
+{ 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+/**
+ * @brief  Check if a year is a leap year.
+ * @param  year: Year (e.g., 2024).
+ * @retval uint8_t: 1 for a leap year, 0 otherwise.
+ */
+uint8_t CAL_IsLeapYear (uint16_t year)
+{
+  return (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0));
+}
+
+/**
+ * @brief  Get the number of days in a month.
+ * @param  year: Year (e.g., 2024).
+ * @param  month: Month (1-12).
+ * @retval uint8_t: Number of days, 0 for an invalid month.
+ */
+uint8_t CAL_DaysInMonth (uint16_t year, uint8_t month)
+{
+  if (month < 1 || month > 12) return 0;
+
+  return daysInMonth[month - 1] + (month == 2 && CAL_IsLeapYear (year));
+}
+
+/**
+ * @brief  Convert a date to the number of days since 2000-01-01.
+ * @param  year: Year (2000 or later).
+ * @param  month: Month (1-12).
+ * @param  day: Day of the month (1-31).
+ * @retval uint32_t: Day number, 0 for 2000-01-01.
+ */
+uint32_t CAL_DaysFromCivil (uint16_t year, uint8_t month, uint8_t day)
+{
+  // January and February belong to the year that started in March before
+  uint32_t y = year - (month <= 2);
+  uint32_t era = y / 400;
+  uint32_t yearOfEra = y - era * 400;                                   // 0..399
+  uint32_t monthFromMarch = (month + 9) % 12;                           // 0 = March
+  uint32_t dayOfYear = (153 * monthFromMarch + 2) / 5 + day - 1;        // 0..365
+  uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+  return era * CAL_DAYS_PER_ERA + dayOfEra - CAL_EPOCH_SHIFT;
+}
+
+/**
+ * @brief  Convert a number of days since 2000-01-01 to a date.
+ * @param  days: Day number, 0 for 2000-01-01.
+ * @param  year: Pointer where the year will be stored.
+ * @param  month: Pointer where the month (1-12) will be stored.
+ * @param  day: Pointer where the day of the month (1-31) will be stored.
+ * @retval None
+ */
+void CAL_CivilFromDays (uint32_t days, uint16_t* year, uint8_t* month, uint8_t* day)
+{
+  uint32_t z = days + CAL_EPOCH_SHIFT;
+  uint32_t era = z / CAL_DAYS_PER_ERA;
+  uint32_t dayOfEra = z - era * CAL_DAYS_PER_ERA;                       // 0..146096
+  uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  uint32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  uint32_t monthFromMarch = (5 * dayOfYear + 2) / 153;                  // 0 = March
+
+  *day = dayOfYear - (153 * monthFromMarch + 2) / 5 + 1;
+  *month = (monthFromMarch < 10) ? monthFromMarch + 3 : monthFromMarch - 9;
+  *year = yearOfEra + era * 400 + (*month <= 2);
+}
+
+/**
+ * @brief  Get the day of the week of a day number.
+ * @param  days: Day number, 0 for 2000-01-01.
+ * @retval CAL_WeekDay_t: Day of the week.
+ */
+CAL_WeekDay_t CAL_WeekDay (uint32_t days)
+{
+  // 2000-01-01 was a Saturday
+  return (CAL_WeekDay_t) ((days + CAL_SATURDAY) % 7);
+}
+
+/**
+ * @brief  Get the day of the month of the last Sunday in a month.
+ * @param  year: Year (2000 or later).
+ * @param  month: Month (1-12).
+ * @retval uint8_t: Day of the month (22-31).
+ */
+uint8_t CAL_LastSunday (uint16_t year, uint8_t month)
+{
+  uint8_t lastDay = CAL_DaysInMonth (year, month);
+  CAL_WeekDay_t weekDay = CAL_WeekDay (CAL_DaysFromCivil (year, month, lastDay));
+
+  return lastDay - (weekDay + 1) % 7;
+}
+
+/**
+ * @brief  Convert RTC time and date to epoch seconds.
+ * @param  time: Pointer to RTC_TimeTypeDef structure.
+ * @param  date: Pointer to RTC_DateTypeDef structure.
+ * @retval uint32_t: Seconds since 2000-01-01 00:00.
+ */
+uint32_t RTC_ToEpochSeconds (RTC_TimeTypeDef* time, RTC_DateTypeDef* date)
+{
+  // RTC year starts from 2000
+  uint32_t days = CAL_DaysFromCivil (CAL_EPOCH_YEAR + date->Year, date->Month, date->Date);
+
+  return days * CAL_SECONDS_PER_DAY + time->Hours * 3600 + time->Minutes * 60 + time->Seconds;
+}
@@ -1,360 +1,580 @@
-/*
- * charts.c
- *
- *  Created on: Dec 21, 2024
- *      Author: piotr
- */
-#include "charts.h"
-#include "ui.h"
-#include "epd2in9.h"
-#include "epdif.h"
-#include "epdpaint.h"
-#include "rtc.h"
-#include "stdio.h"
-
-// ============================================================================
-// Definitions and Constants
-// ============================================================================
-
-#define FLASH_START_ADDRESS   	0x000000   // Start of flash memory space for data
-#define FLASH_END_ADDRESS      	0x00A000   // End of flash memory space
-#define FLASH_SECTOR_SIZE       0x1000     // Sector size: 4 KB
-#define STRUCT_SIZE           	32         // Size of each data structure in bytes
-#define SECONDS_IN_10_MINUTES 	(10 * 60)  // Number of seconds in 10 minutes
-#define CHART_LEFT_END_PIXEL	2
-#define CHART_RIGHT_END_PIXEL	242
-#define CHART_TOP_END_PIXEL	31
-#define CHART_DOWN_END_PIXEL	111
-#define CHART_WIDTH		240
-#define CHART_HEIGHT		80
-
-// ============================================================================
-// Static Helper Functions
-// ============================================================================
-
-/**
- * @brief  Read the last used address from the flash memory.
- * @retval uint32_t: Last used address in flash memory.
- */
-static uint32_t CHARTS_Flash_ReadLastAddress() {
-    uint32_t lastAddress;
-    Flash_Read(FLASH_START_ADDRESS, (uint8_t*)&lastAddress, sizeof(lastAddress));
-
-    // If no valid address is found, initialize to the first available sector
-    if (lastAddress == 0x000000)
-    {
-        lastAddress = FLASH_SECTOR_SIZE;
-    }
-
-    return lastAddress;
-}
-
-/**
- * @brief  Write the last used address to the flash memory.
- * @param  address: The last address to be stored in flash memory.
- * @retval None
- */
-static void CHARTS_Flash_WriteLastAddress(uint32_t address) {
-    Flash_SErase4k(FLASH_START_ADDRESS); // Erase the first flash sector
-    Flash_Write(FLASH_START_ADDRESS, (uint8_t*)&address, sizeof(address));
-}
-
-/**
- * @brief  Read measurement data from flash memory.
- * @param  data: Pointer to an array where the read data will be stored.
- * @param  measurementCount: Number of measurements to read.
- * @retval None
- */
-static void CHARTS_ReadData (CHARTS_t*data, uint16_t measurementCount)
-{
-  uint32_t currentAddress = CHARTS_Flash_ReadLastAddress();
-
-  for(uint16_t i = 0; i < measurementCount; i++)
-  {
-    // Check if the current address has wrapped around to the beginning
-    if (currentAddress < FLASH_SECTOR_SIZE)
-    {
-      // If so, jump to the end of the flash memory space
-      currentAddress = FLASH_END_ADDRESS - STRUCT_SIZE;
-    }
-    // Read a single measurement structure from flash memory at the current address
-    Flash_Read(currentAddress, (uint8_t*)&data[i], STRUCT_SIZE);
-
-    // Move to the previous record (decrement the address by the size of one structure)
-    currentAddress -= STRUCT_SIZE;
-  }
-}
-
-/**
- * @brief  Calculate the number of days in a given month.
- * @param  month: Month (1-12).
- * @param  year: Year (e.g., 2024).
- * @retval uint8_t: Number of days in the given month.
- */
-static uint8_t DaysInMonth(uint8_t month, uint16_t year) {
-    switch (month) {
-        case 1: case 3: case 5: case 7: case 8: case 10: case 12:
-            return 31;
-        case 4: case 6: case 9: case 11:
-            return 30;
-        case 2:
-          // February, account for leap years
-            return (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) ? 29 : 28;
-        default:
-            return 0; // Invalid month
-    }
-}
-
-// ============================================================================
-// Public Functions
-// ============================================================================
-
-/**
- * @brief  Convert RTC time and date to Unix epoch time (seconds since 1970).
- * @param  time: Pointer to RTC_TimeTypeDef structure.
- * @param  date: Pointer to RTC_DateTypeDef structure.
- * @retval uint32_t: Unix epoch time in seconds.
- */
-uint32_t RTC_ToEpochSeconds(RTC_TimeTypeDef* time, RTC_DateTypeDef* date) {
-    uint32_t totalSeconds = 0;
-
-    // RTC year starts from 2000 (assume BCD format)
-    uint16_t year = 2000 + date->Year;
-
-    // Add seconds for full years
-    for (uint16_t y = 2000; y < year; y++) {
-        totalSeconds += (365 + (y % 4 == 0 && (y % 100 != 0 || y % 400 == 0))) * 86400;
-    }
-
-    // Add seconds for full months in the current year
-    for (uint8_t m = 1; m < date->Month; m++) {
-        totalSeconds += DaysInMonth(m, year) * 86400;
-    }
-
-    // Add seconds for full days in the current month
-    totalSeconds += (date->Date - 1) * 86400;
-
-    // Add seconds for hours, minutes, and seconds in the current day
-    totalSeconds += time->Hours * 3600;
-    totalSeconds += time->Minutes * 60;
-    totalSeconds += time->Seconds;
-
-    return totalSeconds;
-}
-
-/**
- * @brief  Calculate the number of elapsed 10-minute intervals.
- * @param  savedEpochSeconds: Previously saved Unix epoch time.
- * @param  currentEpochSeconds: Current Unix epoch time.
- * @retval uint16_t: Number of elapsed 10-minute intervals.
- */
-uint16_t CHARTS_GetElapsed10MinuteIntervals(uint32_t savedEpochSeconds, uint32_t currentEpochSeconds) {
-    if (currentEpochSeconds < savedEpochSeconds) {
-        return 0; // If the saved time is in the future, return 0
-    }
-
-    uint32_t elapsedSeconds = currentEpochSeconds - savedEpochSeconds;
-    return (uint16_t)(elapsedSeconds / SECONDS_IN_10_MINUTES);
-}
-
-/**
- * @brief  Draw a chart on the e-paper display.
- * @param  paint: Pointer to Paint structure for e-paper rendering.
- * @param  type: Type of chart (e.g., temperature, humidity, pressure, battery).
- * @param  range: Time range of the chart (e.g., 8h, 40h, 160h).
- * @param  sTime: Current RTC time.
- * @param  sDate: Current RTC date.
- * @retval None
-*
- * This function retrieves data from flash memory, processes it into a format
- * suitable for rendering, and draws the chart on the e-paper display.
- * It calculates min, max, and current values, and scales the data points
- * according to the specified time range and chart type.
- */
-void CHARTS_DrawCharts (Paint* paint, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef sTime, RTC_DateTypeDef sDate)
-{
-  char text[128]; // Buffer for text to be displayed on the chart
-  uint16_t measurementCount;
-
-  // Determine the number of measurements based on the chart range
-  if (range == RANGE_8H) measurementCount = 48;
-  else if (range == RANGE_40H) measurementCount = 240;
-  else if (range == RANGE_160H) measurementCount = 960;
-
-  // Initialize variables for chart calculations
-  float valueMax = 0, valueMin = 9999, valueNow = 0, valueTable[measurementCount];
-  CHARTS_t data[measurementCount];
-
-  // Read measurement data from flash memory
-  CHARTS_ReadData ((CHARTS_t*) &data, measurementCount);
-
-  // Convert RTC time to epoch time
-  uint32_t currentEpochSeconds = RTC_ToEpochSeconds(&sTime, &sDate);
-
-  // Initialize value table
-  for (uint16_t i = 0; i < measurementCount; i++)
-    valueTable[i] = 0;
-
-  // Process measurement data
-  for (uint16_t i = 0; i < measurementCount; i++)
-  {
-    // Calculate the elapsed 10-minute intervals since the data was recorded
-    uint16_t elapsedIntervals = CHARTS_GetElapsed10MinuteIntervals (data[i].epoch_seconds, currentEpochSeconds);
-
-    // Check if the data point is within the time range and is valid
-    if (elapsedIntervals < measurementCount && data[i].epoch_seconds != 0xffffffff)
-    {
-      // Assign the appropriate value to the value table based on the chart type
-      if (type == TEMPERATURE_CHART) valueTable[elapsedIntervals] = data[i].temperature;
-      else if (type == HUMIDITY_CHART) valueTable[elapsedIntervals] = data[i].humidity;
-      else if (type == PRESSURE_CHART) valueTable[elapsedIntervals] = data[i].pressure;
-      else if (type == BATTERY_LEVEL_CHART) valueTable[elapsedIntervals] = data[i].battery_level;
-
-      // Update the min and max values for the chart
-      if (valueTable[elapsedIntervals] < valueMin) valueMin = valueTable[elapsedIntervals];
-      if (valueTable[elapsedIntervals] > valueMax) valueMax = valueTable[elapsedIntervals];
-
-      // Set the current value if it has not yet been set
-      if (valueNow == 0) valueNow = valueTable[elapsedIntervals];
-    }
-  }
-
-  // Special case for battery level charts: set fixed min and max values
-  if (type == BATTERY_LEVEL_CHART)
-  {
-    valueMin = 0;
-    valueMax = 100;
-
-  }
-
-  // Variables for drawing lines on the chart
-  uint8_t x0 = 0, x1 = 0, y0 = 0, y1 = 0;
-
-  // Iterate through the value table to draw the chart lines
-  for (uint16_t i = 1; i < measurementCount; i++)
-  {
-    // Skip invalid data points or cases where min equals max
-    if (valueTable[i] == 0 || valueTable[i - 1] == 0 || valueMax == valueMin)
-    {
-      continue;
-    }
-
-    // Calculate coordinates for the current and previous data points based on the range
-    if (range == RANGE_8H)
-    {
-      y0 = (80 - (((valueTable[i - 1] - valueMin) / (valueMax - valueMin)) * CHART_HEIGHT)) + CHART_TOP_END_PIXEL;
-      y1 = (80 - (((valueTable[i] - valueMin) / (valueMax - valueMin)) * CHART_HEIGHT)) + CHART_TOP_END_PIXEL;
-      x0 = CHART_RIGHT_END_PIXEL - ((i - 1) * 5);
-      x1 = CHART_RIGHT_END_PIXEL - ((i - 1) * 5) - 5;
-    }
-    else if (range == RANGE_40H)
-    {
-      y0 = (80 - (((valueTable[i - 1] - valueMin) / (valueMax - valueMin)) * CHART_HEIGHT)) + CHART_TOP_END_PIXEL;
-      y1 = (80 - (((valueTable[i] - valueMin) / (valueMax - valueMin)) * CHART_HEIGHT)) + CHART_TOP_END_PIXEL;
-      x0 = CHART_RIGHT_END_PIXEL - (i - 1);
-      x1 = CHART_RIGHT_END_PIXEL - (i - 1) - 1;
-    }
-    else if (range == RANGE_160H)
-    {
-      if ((i - 1) % 4 == 0)
-      {
-	// Calculate averages for data smoothing (4-point moving average)
-	if (valueTable[i - 1] == 0 || valueTable[i] == 0 || valueTable[i + 1] == 0 || valueTable[i + 2] == 0 || valueTable[i + 3] == 0 || valueTable[i + 4] == 0
-	    || valueTable[i + 5] == 0 || valueTable[i + 6] == 0)
-	{
-	  continue;
-	}
-	float tempVar1, tempVar2;
-	if (i + 6 < measurementCount)
-	{
-	  tempVar1 = (valueTable[i - 1] + valueTable[i] + valueTable[i + 1] + valueTable[i + 2]) / 4;
-	  tempVar2 = (valueTable[i + 3] + valueTable[i + 4] + valueTable[i + 5] + valueTable[i + 6]) / 4;
-	}
-	y0 = (80 - (((tempVar1 - valueMin) / (valueMax - valueMin)) * CHART_HEIGHT)) + CHART_TOP_END_PIXEL;
-	y1 = (80 - (((tempVar2 - valueMin) / (valueMax - valueMin)) * CHART_HEIGHT)) + CHART_TOP_END_PIXEL;
-	x0 = CHART_RIGHT_END_PIXEL - ((i / 4) - 1);
-	x1 = CHART_RIGHT_END_PIXEL - ((i / 4) - 1) - 1;
-      }
-
-    }
-
-    // Draw a line between the two calculated points
-    Paint_DrawLine (paint, x0, y0, x1, y1, COLORED);
-  }
-
-  // Add text labels and values to the chart
-  if (type == TEMPERATURE_CHART)
-  {
-    sprintf (text, "Temperature");
-    Paint_DrawStringAt (paint, 53, 5, text, &Font24, COLORED);
-    sprintf (text, "%.1fMax", valueMax);
-    Paint_DrawStringAt (paint, 245, 27, text, &Font12, COLORED);
-    sprintf (text, "%.1f'C", valueNow);
-    Paint_DrawStringAt (paint, 247, 67, text, &Font12, COLORED);
-    sprintf (text, "%.1fMin", valueMin);
-    Paint_DrawStringAt (paint, 245, 107, text, &Font12, COLORED);
-  }
-  else if (type == HUMIDITY_CHART)
-  {
-    sprintf (text, "Humidity");
-    Paint_DrawStringAt (paint, 75, 5, text, &Font24, COLORED);
-    sprintf (text, "%02d%%Max", (int) valueMax);
-    Paint_DrawStringAt (paint, 245, 27, text, &Font12, COLORED);
-    sprintf (text, "%02d%%Rh", (int) valueNow);
-    Paint_DrawStringAt (paint, 247, 67, text, &Font12, COLORED);
-    sprintf (text, "%02d%%Min", (int) valueMin);
-    Paint_DrawStringAt (paint, 245, 107, text, &Font12, COLORED);
-  }
-  else if (type == PRESSURE_CHART)
-  {
-    sprintf (text, "Pressure");
-    Paint_DrawStringAt (paint, 75, 5, text, &Font24, COLORED);
-    sprintf (text, "%04dMax", (int) valueMax);
-    Paint_DrawStringAt (paint, 245, 27, text, &Font12, COLORED);
-    sprintf (text, "%04dhPa", (int) valueNow);
-    Paint_DrawStringAt (paint, 245, 67, text, &Font12, COLORED);
-    sprintf (text, "%04dMin", (int) valueMin);
-    Paint_DrawStringAt (paint, 245, 107, text, &Font12, COLORED);
-  }
-  else if (type == BATTERY_LEVEL_CHART)
-  {
-    sprintf (text, "Battery level");
-    Paint_DrawStringAt (paint, 30, 5, text, &Font24, COLORED);
-    sprintf (text, "100%%");
-    Paint_DrawStringAt (paint, 260, 27, text, &Font12, COLORED);
-    sprintf (text, "%d%%", (int) valueNow);
-    Paint_DrawStringAt (paint, 262, 67, text, &Font12, COLORED);
-    sprintf (text, "0%%");
-    Paint_DrawStringAt (paint, 265, 107, text, &Font12, COLORED);
-  }
-}
-
-void CHARTS_SaveData (CHARTS_t* data)
-{
-  uint32_t lastAddress = CHARTS_Flash_ReadLastAddress ();
-
-  // If the last address is uninitialized (0xFFFFFFFF) or below the minimum valid sector size,
-  // reset it to the starting address of the first flash memory sector (FLASH_SECTOR_SIZE).
-  if (lastAddress == 0xFFFFFFFF || lastAddress < FLASH_SECTOR_SIZE) lastAddress = FLASH_SECTOR_SIZE;
-
-  // Calculate the next address for writing
-  uint32_t nextAddress = lastAddress + STRUCT_SIZE;
-
-  // Check if the available space is exceeded
-  if (nextAddress + STRUCT_SIZE > FLASH_END_ADDRESS)
-  {
-    nextAddress = FLASH_START_ADDRESS + FLASH_SECTOR_SIZE; // Przejście na początek dostępnej przestrzeni
-  }
-
-  // Erase the new sector if entering a new one
-  if (nextAddress % FLASH_SECTOR_SIZE == 0)
-  {
-    Flash_SErase4k (nextAddress); // Kasowanie nowego sektora
-  }
-
-  // Write the data to flash memory
-  Flash_Write (nextAddress, (uint8_t*) data, STRUCT_SIZE);
-
-  // Update the last written address
-  CHARTS_Flash_WriteLastAddress (nextAddress);
-}
+/*
+ * charts.c
+ *
+ *  Created on: Dec 21, 2024
+ *      Author: piotr
+ */
+#include "charts.h"
+#include "ui.h"
+#include "epd2in9.h"
+#include "epdif.h"
+#include "epdpaint.h"
+#include "rtc.h"
+#include "stdio.h"
+#include "string.h"
+#include "sample_log.h"
+#include "calendar.h"
+#include "ftl.h"
+
+// ============================================================================
+// Definitions and Constants
+// ============================================================================
+
+#define SECONDS_IN_10_MINUTES 	(10 * 60)  // Number of seconds in 10 minutes
+#define CHART_LEFT_END_PIXEL	2
+#define CHART_RIGHT_END_PIXEL	242
+#define CHART_TOP_END_PIXEL	31
+#define CHART_DOWN_END_PIXEL	111
+#define CHART_WIDTH		240
+#define CHART_HEIGHT		80
+#define CHART_MAX_COLUMNS	240
+#define CHART_SERIES_COUNT	4          // Temperature, humidity, pressure, battery level
+#define CHART_RANGE_COUNT	3          // 8h, 40h, 160h
+
+/*
+ * Rendered CHARTS screens are kept in the external flash, in logical sectors of the FTL.
+ * Every chart type and range has its own slot: a header with the key followed by the frame buffer.
+ */
+#define CHART_FRAME_FIRST_SECTOR	0          // First FTL logical sector of the cache
+#define CHART_FRAME_SLOT_SECTORS	2          // Two logical sectors, enough for the 4736 byte frame buffer
+#define CHART_FRAME_SLOT_SIZE		(CHART_FRAME_SLOT_SECTORS * FTL_DATA_SIZE)
+#define CHART_FRAME_SLOT_COUNT		15         // 5 chart types x 3 ranges
+#define CHART_FRAME_HEADER_SIZE		32
+#define CHART_FRAME_MAGIC		0x4D524643 // "CFRM"
+
+// Every chart type and range needs a slot, and all slots must fit into the FTL
+_Static_assert(CHART_FRAME_SLOT_COUNT >= TEMPERATURE_HUMIDITY_CHART * RANGE_160H,
+               "CHART_FRAME_SLOT_COUNT must cover every chart type and range");
+_Static_assert(CHART_FRAME_FIRST_SECTOR + CHART_FRAME_SLOT_COUNT * CHART_FRAME_SLOT_SECTORS <= FTL_LOGICAL_SECTORS,
+               "The chart frame slots don't fit into the FTL logical sectors");
+
+// ============================================================================
+// Static Helper Functions
+// ============================================================================
+
+/*
+ * Aggregate of the samples falling into one chart column
+ */
+typedef struct
+{
+  float sum;
+  float min;
+  float max;
+} CHARTS_Column_t;
+
+/*
+ * Columns and summary values of one chart type
+ */
+typedef struct
+{
+  CHARTS_Column_t column[CHART_MAX_COLUMNS]; // Column 0 is the newest one
+  float valueMin;
+  float valueMax;
+  float valueNow;
+} CHARTS_Series_t;
+
+/*
+ * Chart data kept in RAM while the device is awake. All chart types are projections of the
+ * same records, so they are collected in one pass and switching the type needs no flash reads.
+ * Columns are anchored to absolute groups of 10-minute slots, so a new sample only shifts
+ * the table and updates one column. Every record saved through CHARTS_SaveData() is added,
+ * so the cache always ends with the head record of the sample log.
+ */
+typedef struct
+{
+  uint8_t isValid;
+  CHART_RANGE_POSITION_t range;
+  uint16_t columnCount;                      // Number of columns on the chart
+  uint8_t samplesPerColumn;                  // 10-minute samples aggregated into one column
+  uint32_t newestGroup;                      // Group of 10-minute slots shown in column 0
+  uint8_t count[CHART_MAX_COLUMNS];          // Number of samples in a column, 0 = no data
+  CHARTS_Series_t series[CHART_SERIES_COUNT]; // Indexed by chart type - 1
+} CHARTS_Cache_t;
+
+static CHARTS_Cache_t chartCache;
+
+/*
+ * Header of a rendered frame stored in the flash
+ */
+typedef struct
+{
+  uint32_t magic;         // CHART_FRAME_MAGIC once the frame has been completely written
+  uint32_t recordNumber;  // Newest record of the sample log when the frame was drawn
+  uint32_t slot;          // 10-minute slot of the drawing time
+  uint32_t size;          // Size of the frame buffer
+  uint8_t type;
+  uint8_t range;
+  uint8_t padding[14];    // padding to CHART_FRAME_HEADER_SIZE
+} CHARTS_FrameHeader_t;
+
+/**
+ * @brief  Get the value of a record displayed on a given chart type.
+ * @param  record: Record read from the sample log.
+ * @param  type: Chart type.
+ * @retval float: Value of the record.
+ */
+static float CHARTS_GetValue (const CHARTS_t* record, CHART_TYPE_POSITION_t type)
+{
+  if (type == TEMPERATURE_CHART) return record->temperature;
+  else if (type == HUMIDITY_CHART) return record->humidity;
+  else if (type == PRESSURE_CHART) return record->pressure;
+  else if (type == BATTERY_LEVEL_CHART) return record->battery_level;
+  return 0;
+}
+
+/**
+ * @brief  Get the group of 10-minute slots a time belongs to.
+ * @param  epochSeconds: Unix epoch time.
+ * @retval uint32_t: Group number.
+ */
+static uint32_t CHARTS_GetGroup (uint32_t epochSeconds)
+{
+  return (epochSeconds / SECONDS_IN_10_MINUTES) / chartCache.samplesPerColumn;
+}
+
+/**
+ * @brief  Clear the min, max and current value of all series.
+ * @retval None
+ */
+static void CHARTS_ResetSeries (void)
+{
+  for (uint8_t s = 0; s < CHART_SERIES_COUNT; s++)
+  {
+    chartCache.series[s].valueMin = 9999;
+    chartCache.series[s].valueMax = 0;
+    chartCache.series[s].valueNow = 0;
+  }
+}
+
+/**
+ * @brief  Recalculate min and max of a series from its column aggregates.
+ * @param  series: Series to be updated.
+ * @retval None
+ */
+static void CHARTS_RescanExtremes (CHARTS_Series_t* series)
+{
+  series->valueMin = 9999;
+  series->valueMax = 0;
+
+  for (uint16_t i = 0; i < chartCache.columnCount; i++)
+  {
+    if (chartCache.count[i] == 0) continue;
+    if (series->column[i].min < series->valueMin) series->valueMin = series->column[i].min;
+    if (series->column[i].max > series->valueMax) series->valueMax = series->column[i].max;
+  }
+}
+
+/**
+ * @brief  Move the chart forward so that column 0 shows the given group.
+ * @param  newestGroup: Group of the newest column.
+ * @retval None
+ *
+ * Columns which fall off the chart are dropped. Min and max of a series are only
+ * recalculated when one of the dropped columns held its extreme value.
+ */
+static void CHARTS_ShiftColumns (uint32_t newestGroup)
+{
+  if (newestGroup <= chartCache.newestGroup) return;
+
+  uint32_t shift = newestGroup - chartCache.newestGroup;
+  uint16_t kept = chartCache.columnCount - shift;
+  chartCache.newestGroup = newestGroup;
+
+  if (shift >= chartCache.columnCount)
+  {
+    memset (chartCache.count, 0, sizeof(chartCache.count));
+    CHARTS_ResetSeries ();
+    return;
+  }
+
+  // Check which series lose their extreme value with the dropped columns
+  uint8_t rescan[CHART_SERIES_COUNT] = { 0 };
+  for (uint8_t s = 0; s < CHART_SERIES_COUNT; s++)
+  {
+    CHARTS_Series_t* series = &chartCache.series[s];
+
+    for (uint16_t i = kept; i < chartCache.columnCount; i++)
+    {
+      if (chartCache.count[i] == 0) continue;
+      if (series->column[i].min <= series->valueMin || series->column[i].max >= series->valueMax) rescan[s] = 1;
+    }
+    memmove (&series->column[shift], &series->column[0], kept * sizeof(series->column[0]));
+  }
+
+  memmove (&chartCache.count[shift], &chartCache.count[0], kept * sizeof(chartCache.count[0]));
+  memset (chartCache.count, 0, shift * sizeof(chartCache.count[0]));
+
+  for (uint8_t s = 0; s < CHART_SERIES_COUNT; s++)
+  {
+    if (rescan[s]) CHARTS_RescanExtremes (&chartCache.series[s]);
+  }
+}
+
+/**
+ * @brief  Add one record to the column it belongs to, for all chart types.
+ * @param  record: Record read from the sample log or just saved.
+ * @retval None
+ */
+static void CHARTS_AddSample (const CHARTS_t* record)
+{
+  uint32_t group = CHARTS_GetGroup (record->epoch_seconds);
+
+  // A record newer than the chart moves it forward
+  CHARTS_ShiftColumns (group);
+  if (chartCache.newestGroup - group >= chartCache.columnCount) return;
+
+  uint16_t i = chartCache.newestGroup - group;
+
+  for (uint8_t s = 0; s < CHART_SERIES_COUNT; s++)
+  {
+    CHARTS_Series_t* series = &chartCache.series[s];
+    float value = CHARTS_GetValue (record, TEMPERATURE_CHART + s);
+
+    if (chartCache.count[i] == 0)
+    {
+      series->column[i].sum = 0;
+      series->column[i].min = value;
+      series->column[i].max = value;
+    }
+    series->column[i].sum += value;
+    if (value < series->column[i].min) series->column[i].min = value;
+    if (value > series->column[i].max) series->column[i].max = value;
+
+    // Update the min and max values for the chart
+    if (value < series->valueMin) series->valueMin = value;
+    if (value > series->valueMax) series->valueMax = value;
+
+    // Records come oldest first, so the last one is the current value
+    series->valueNow = value;
+  }
+  chartCache.count[i]++;
+}
+
+/**
+ * @brief  Sample log callback: place one record in the chart columns.
+ * @param  record: Record read from the sample log.
+ * @param  context: Unused.
+ * @retval None
+ */
+static void CHARTS_CollectRecord (const CHARTS_t* record, void* context)
+{
+  CHARTS_AddSample (record);
+}
+
+/**
+ * @brief  Fill the chart columns of all chart types from the flash sample log.
+ * @param  range: Time range of the chart.
+ * @param  currentEpochSeconds: Time of drawing.
+ * @retval None
+ */
+static void CHARTS_LoadCache (CHART_RANGE_POSITION_t range, uint32_t currentEpochSeconds)
+{
+  chartCache.range = range;
+
+  // Determine the number of columns and measurements per column based on the chart range
+  if (range == RANGE_40H)
+  {
+    chartCache.columnCount = 240;
+    chartCache.samplesPerColumn = 1;
+  }
+  else if (range == RANGE_160H)
+  {
+    chartCache.columnCount = 240;
+    chartCache.samplesPerColumn = 4;
+  }
+  else
+  {
+    chartCache.columnCount = 48;
+    chartCache.samplesPerColumn = 1;
+  }
+
+  memset (chartCache.count, 0, sizeof(chartCache.count));
+  chartCache.newestGroup = CHARTS_GetGroup (currentEpochSeconds);
+  CHARTS_ResetSeries ();
+
+  // Read only the records which fall into the chart range
+  uint32_t groupSeconds = (uint32_t) chartCache.samplesPerColumn * SECONDS_IN_10_MINUTES;
+  uint32_t startEpoch = 0;
+  if (chartCache.newestGroup >= chartCache.columnCount)
+    startEpoch = (chartCache.newestGroup - chartCache.columnCount + 1) * groupSeconds;
+  SLOG_ReadRange (startEpoch, currentEpochSeconds, CHARTS_CollectRecord, NULL);
+
+  chartCache.isValid = 1;
+}
+
+/**
+ * @brief  Draw the line of one series from the cached columns.
+ * @param  paint: Pointer to Paint structure for e-paper rendering.
+ * @param  series: Series to be drawn.
+ * @param  valueMin: Value at the bottom of the chart.
+ * @param  valueMax: Value at the top of the chart.
+ * @param  columnWidth: Distance between the points of neighbouring columns.
+ * @param  isDashed: Draw every other segment only, to tell a secondary series apart.
+ * @retval None
+ */
+static void CHARTS_DrawSeries (Paint* paint, const CHARTS_Series_t* series, float valueMin, float valueMax, uint8_t columnWidth, uint8_t isDashed)
+{
+  // Variables for drawing lines on the chart
+  uint8_t x0 = 0, x1 = 0, y0 = 0, y1 = 0;
+
+  // Iterate through the columns to draw the chart lines
+  for (uint16_t i = 1; i < chartCache.columnCount; i++)
+  {
+    // Skip columns without data or cases where min equals max
+    if (chartCache.count[i] == 0 || chartCache.count[i - 1] == 0 || valueMax == valueMin)
+    {
+      continue;
+    }
+
+    // Gaps of the dashed line, 4 pixels long
+    if (isDashed && ((i * columnWidth) / 4) % 2)
+    {
+      continue;
+    }
+
+    // Average of the samples in the current and previous column
+    float value0 = series->column[i - 1].sum / chartCache.count[i - 1];
+    float value1 = series->column[i].sum / chartCache.count[i];
+
+    // Calculate coordinates for the current and previous data points
+    y0 = (80 - (((value0 - valueMin) / (valueMax - valueMin)) * CHART_HEIGHT)) + CHART_TOP_END_PIXEL;
+    y1 = (80 - (((value1 - valueMin) / (valueMax - valueMin)) * CHART_HEIGHT)) + CHART_TOP_END_PIXEL;
+    x0 = CHART_RIGHT_END_PIXEL - ((i - 1) * columnWidth);
+    x1 = CHART_RIGHT_END_PIXEL - (i * columnWidth);
+
+    // Draw a line between the two calculated points
+    Paint_DrawLine (paint, x0, y0, x1, y1, COLORED);
+  }
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+/**
+ * @brief  Draw a chart on the e-paper display.
+ * @param  paint: Pointer to Paint structure for e-paper rendering.
+ * @param  type: Type of chart (e.g., temperature, humidity, pressure, battery).
+ * @param  range: Time range of the chart (e.g., 8h, 40h, 160h).
+ * @param  sTime: Current RTC time.
+ * @param  sDate: Current RTC date.
+ * @retval None
+*
+ * This function retrieves data from flash memory, processes it into a format
+ * suitable for rendering, and draws the chart on the e-paper display.
+ * It calculates min, max, and current values, and scales the data points
+ * according to the specified time range and chart type.
+ * Flash is read only when the range changed since the last call, otherwise
+ * the column aggregates kept in RAM for all chart types are reused.
+ */
+void CHARTS_DrawCharts (Paint* paint, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef sTime, RTC_DateTypeDef sDate)
+{
+  char text[128]; // Buffer for text to be displayed on the chart
+  float valueMax, valueMin, valueNow;
+
+  // Convert RTC time to epoch time
+  uint32_t currentEpochSeconds = RTC_ToEpochSeconds(&sTime, &sDate);
+
+  // Move the columns with the time or rebuild them when the range changed
+  if (!chartCache.isValid || chartCache.range != range)
+    CHARTS_LoadCache (range, currentEpochSeconds);
+  else
+    CHARTS_ShiftColumns (CHARTS_GetGroup (currentEpochSeconds));
+
+  // The overlay chart shows temperature with humidity, both taken from the same cached columns
+  CHARTS_Series_t* series = &chartCache.series[(type == TEMPERATURE_HUMIDITY_CHART) ? 0 : type - TEMPERATURE_CHART];
+  CHARTS_Series_t* secondary = &chartCache.series[HUMIDITY_CHART - TEMPERATURE_CHART];
+  valueMin = series->valueMin;
+  valueMax = series->valueMax;
+  valueNow = series->valueNow;
+
+  // Special case for battery level charts: set fixed min and max values
+  if (type == BATTERY_LEVEL_CHART)
+  {
+    valueMin = 0;
+    valueMax = 100;
+
+  }
+
+  // Distance between the points of neighbouring columns
+  uint8_t columnWidth = (range == RANGE_8H) ? 5 : 1;
+
+  // Draw the lines, the secondary series of the overlay chart is dashed and scaled to its own range
+  CHARTS_DrawSeries (paint, series, valueMin, valueMax, columnWidth, 0);
+  if (type == TEMPERATURE_HUMIDITY_CHART)
+    CHARTS_DrawSeries (paint, secondary, secondary->valueMin, secondary->valueMax, columnWidth, 1);
+
+  // Add text labels and values to the chart
+  if (type == TEMPERATURE_CHART)
+  {
+    sprintf (text, "Temperature");
+    Paint_DrawStringAt (paint, 53, 5, text, &Font24, COLORED);
+    sprintf (text, "%.1fMax", valueMax);
+    Paint_DrawStringAt (paint, 245, 27, text, &Font12, COLORED);
+    sprintf (text, "%.1f'C", valueNow);
+    Paint_DrawStringAt (paint, 247, 67, text, &Font12, COLORED);
+    sprintf (text, "%.1fMin", valueMin);
+    Paint_DrawStringAt (paint, 245, 107, text, &Font12, COLORED);
+  }
+  else if (type == HUMIDITY_CHART)
+  {
+    sprintf (text, "Humidity");
+    Paint_DrawStringAt (paint, 75, 5, text, &Font24, COLORED);
+    sprintf (text, "%02d%%Max", (int) valueMax);
+    Paint_DrawStringAt (paint, 245, 27, text, &Font12, COLORED);
+    sprintf (text, "%02d%%Rh", (int) valueNow);
+    Paint_DrawStringAt (paint, 247, 67, text, &Font12, COLORED);
+    sprintf (text, "%02d%%Min", (int) valueMin);
+    Paint_DrawStringAt (paint, 245, 107, text, &Font12, COLORED);
+  }
+  else if (type == PRESSURE_CHART)
+  {
+    sprintf (text, "Pressure");
+    Paint_DrawStringAt (paint, 75, 5, text, &Font24, COLORED);
+    sprintf (text, "%04dMax", (int) valueMax);
+    Paint_DrawStringAt (paint, 245, 27, text, &Font12, COLORED);
+    sprintf (text, "%04dhPa", (int) valueNow);
+    Paint_DrawStringAt (paint, 245, 67, text, &Font12, COLORED);
+    sprintf (text, "%04dMin", (int) valueMin);
+    Paint_DrawStringAt (paint, 245, 107, text, &Font12, COLORED);
+  }
+  else if (type == BATTERY_LEVEL_CHART)
+  {
+    sprintf (text, "Battery level");
+    Paint_DrawStringAt (paint, 30, 5, text, &Font24, COLORED);
+    sprintf (text, "100%%");
+    Paint_DrawStringAt (paint, 260, 27, text, &Font12, COLORED);
+    sprintf (text, "%d%%", (int) valueNow);
+    Paint_DrawStringAt (paint, 262, 67, text, &Font12, COLORED);
+    sprintf (text, "0%%");
+    Paint_DrawStringAt (paint, 265, 107, text, &Font12, COLORED);
+  }
+  else if (type == TEMPERATURE_HUMIDITY_CHART)
+  {
+    sprintf (text, "Temp & Hum");
+    Paint_DrawStringAt (paint, 60, 5, text, &Font24, COLORED);
+    sprintf (text, "%.1f'C", valueMax);
+    Paint_DrawStringAt (paint, 247, 27, text, &Font12, COLORED);
+    sprintf (text, "%02d%%", (int) secondary->valueMax);
+    Paint_DrawStringAt (paint, 247, 39, text, &Font12, COLORED);
+    sprintf (text, "%.1f'C", valueNow);
+    Paint_DrawStringAt (paint, 247, 61, text, &Font12, COLORED);
+    sprintf (text, "%02d%%", (int) secondary->valueNow);
+    Paint_DrawStringAt (paint, 247, 73, text, &Font12, COLORED);
+    sprintf (text, "%.1f'C", valueMin);
+    Paint_DrawStringAt (paint, 247, 95, text, &Font12, COLORED);
+    sprintf (text, "%02d%%", (int) secondary->valueMin);
+    Paint_DrawStringAt (paint, 247, 107, text, &Font12, COLORED);
+  }
+}
+
+/**
+ * @brief  Get the first FTL logical sector of the cached frame of a chart.
+ * @param  type: Type of chart.
+ * @param  range: Time range of the chart.
+ * @retval uint16_t: Logical sector of the slot header.
+ */
+static uint16_t CHARTS_GetFrameSlot (CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range)
+{
+  return CHART_FRAME_FIRST_SECTOR + ((type - 1) * CHART_RANGE_COUNT + (range - 1)) * CHART_FRAME_SLOT_SECTORS;
+}
+
+/**
+ * @brief  Fill the key of a cached frame.
+ * @param  header: Header to be filled.
+ * @param  size: Size of the frame buffer.
+ * @param  type: Type of chart.
+ * @param  range: Time range of the chart.
+ * @param  sTime: Current RTC time.
+ * @param  sDate: Current RTC date.
+ * @retval None
+ */
+static void CHARTS_GetFrameKey (CHARTS_FrameHeader_t* header, uint32_t size, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef* sTime, RTC_DateTypeDef* sDate)
+{
+  memset (header, 0xFF, sizeof(CHARTS_FrameHeader_t));
+  header->magic = CHART_FRAME_MAGIC;
+  header->recordNumber = SLOG_GetRecordNumber ();
+  header->slot = RTC_ToEpochSeconds (sTime, sDate) / SECONDS_IN_10_MINUTES;
+  header->size = size;
+  header->type = type;
+  header->range = range;
+}
+
+/**
+ * @brief  Find a rendered CHARTS screen in the flash if it is still up to date.
+ * @param  parts: Pointer where the flash location of the frame will be stored.
+ * @param  size: Size of the frame buffer.
+ * @param  type: Type of chart.
+ * @param  range: Time range of the chart.
+ * @param  sTime: Current RTC time.
+ * @param  sDate: Current RTC date.
+ * @retval uint8_t: 1 if the frame was found, 0 if the chart has to be drawn.
+ *
+ * A cached frame is valid while no record was added to the sample log and the
+ * chart didn't move to the next 10-minute slot. Only the header is read, the frame
+ * can be streamed from the flash to the display without a copy in RAM.
+ */
+uint8_t CHARTS_FindFrame (CHARTS_FrameParts_t* parts, uint32_t size, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef sTime, RTC_DateTypeDef sDate)
+{
+  CHARTS_FrameHeader_t key, header;
+  uint16_t sector = CHARTS_GetFrameSlot (type, range);
+  uint32_t headSize = FTL_DATA_SIZE - CHART_FRAME_HEADER_SIZE;
+  uint32_t address, tailAddress;
+
+  if (size > CHART_FRAME_SLOT_SIZE - CHART_FRAME_HEADER_SIZE || size <= headSize) return 0;
+  if (!FTL_GetDataAddress (sector, &address) || !FTL_GetDataAddress (sector + 1, &tailAddress)) return 0;
+
+  CHARTS_GetFrameKey (&key, size, type, range, &sTime, &sDate);
+  Flash_Read (address, (uint8_t*) &header, sizeof(header));
+  if (memcmp (&key, &header, sizeof(header)) != 0) return 0;
+
+  parts->address[0] = address + CHART_FRAME_HEADER_SIZE;
+  parts->length[0] = headSize;
+  parts->address[1] = tailAddress;
+  parts->length[1] = size - headSize;
+  return 1;
+}
+
+/**
+ * @brief  Save a rendered CHARTS screen to the flash.
+ * @param  frame: Frame buffer with the complete screen.
+ * @param  size: Size of the frame buffer.
+ * @param  type: Type of chart.
+ * @param  range: Time range of the chart.
+ * @param  sTime: Current RTC time.
+ * @param  sDate: Current RTC date.
+ * @retval None
+ *
+ * The second sector is written before the one with the header. The FTL keeps the previous
+ * copy of a sector until the new one is complete, and the key of an older frame never matches
+ * again, so a slot interrupted by a power loss is never used.
+ */
+void CHARTS_StoreFrame (const unsigned char* frame, uint32_t size, CHART_TYPE_POSITION_t type, CHART_RANGE_POSITION_t range, RTC_TimeTypeDef sTime, RTC_DateTypeDef sDate)
+{
+  CHARTS_FrameHeader_t header;
+  uint16_t sector = CHARTS_GetFrameSlot (type, range);
+  uint32_t headSize = FTL_DATA_SIZE - CHART_FRAME_HEADER_SIZE;
+
+  if (size > CHART_FRAME_SLOT_SIZE - CHART_FRAME_HEADER_SIZE || size <= headSize) return;
+
+  CHARTS_GetFrameKey (&header, size, type, range, &sTime, &sDate);
+  if (!FTL_Write (sector + 1, frame + headSize, size - headSize)) return;
+  if (!FTL_BeginWrite (sector)) return;
+  FTL_WriteData (&header, sizeof(header));
+  FTL_WriteData (frame, headSize);
+  FTL_EndWrite ();
+}
+
+/**
+ * @brief  Store a new measurement in the flash sample log.
+ * @param  data: Pointer to the measurement to be saved.
+ * @retval None
+ *
+ * The measurement is also added to the chart kept in RAM, so the next
+ * CHARTS_DrawCharts() call doesn't need to read the flash.
+ */
+void CHARTS_SaveData (CHARTS_t* data)
+{
+  SLOG_Append (data);
+  if (chartCache.isValid) CHARTS_AddSample (data);
+}
@@ -0,0 +1,383 @@
+/*
+ * ftl.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ *
+ *  This file implements a small flash translation layer over the W25Q driver.
+ *  A logical sector is never rewritten in place: a new copy goes to the free physical
+ *  sector with the lowest erase count (dynamic wear levelling) and the previous copy
+ *  becomes free. Data which is never rewritten would keep its sectors young, so when
+ *  the erase counts spread by more than FTL_STATIC_THRESHOLD the coldest logical sector
+ *  is moved to the most worn free sector (static wear levelling).
+ *
+ *  The map is not stored anywhere. At mount the header of every physical sector is read
+ *  once: a valid header names its logical sector and a version number, the highest
+ *  version of a logical sector is the current copy. A write interrupted by a power loss
+ *  leaves a sector without the magic number, so the previous copy stays current.
+ *  Only the map and the erase counts are kept in RAM.
+ */
+
+#include "ftl.h"
+#include "z_flash_W25QXXX.h"
+#include "string.h"
+#include "stddef.h"
+
+// ============================================================================
+// Definitions and Constants
+// ============================================================================
+
+#define FTL_EMPTY_WORD		0xFFFFFFFF // Content of an erased flash word
+#define FTL_NO_SECTOR		0xFFFF     // Logical sector not written yet
+#define FTL_COPY_CHUNK		256        // Bytes copied at once by the static levelling
+
+// ============================================================================
+// Private Variables
+// ============================================================================
+
+static uint8_t isMounted = 0;
+static uint16_t sectorCount = 0;                       // Physical sectors available on the chip
+static uint16_t sectorMap[FTL_LOGICAL_SECTORS];        // Physical sector of every logical sector
+static uint32_t eraseCount[FTL_PHYSICAL_SECTORS];
+static uint8_t usedMap[FTL_PHYSICAL_SECTORS / 8];      // Physical sectors holding a current copy
+static uint32_t nextVersion;
+static uint16_t allocCursor;                           // Free sectors with equal counts are taken in turn
+
+// Write opened by FTL_BeginWrite()
+static uint8_t isWriting = 0;
+static uint16_t writeLogical;
+static uint16_t writeSector;
+static uint32_t writeOffset;
+
+// ============================================================================
+// Static Helper Functions
+// ============================================================================
+
+/**
+ * @brief  Get the flash address of a physical sector.
+ * @param  sector: Physical sector.
+ * @retval uint32_t: Address of the sector header.
+ */
+static uint32_t FTL_SectorAddress (uint16_t sector)
+{
+  return FTL_START_ADDRESS + (uint32_t) sector * FTL_SECTOR_SIZE;
+}
+
+static uint8_t FTL_IsUsed (uint16_t sector)
+{
+  return (usedMap[sector / 8] >> (sector % 8)) & 1;
+}
+
+static void FTL_SetUsed (uint16_t sector, uint8_t used)
+{
+  if (used) usedMap[sector / 8] |= 1 << (sector % 8);
+  else usedMap[sector / 8] &= ~(1 << (sector % 8));
+}
+
+/**
+ * @brief  Compute the check of a sector header.
+ * @param  header: Header with the erase count, version and logical sector set.
+ * @retval uint16_t: Check value.
+ */
+static uint16_t FTL_HeaderCheck (const FTL_SectorHeader_t* header)
+{
+  uint32_t check = header->eraseCount * 31 + header->version;
+
+  check = check * 31 + header->logical;
+  check ^= check >> 16;
+  return (uint16_t) ~check;
+}
+
+/**
+ * @brief  Check if a header describes a complete copy of a logical sector.
+ * @param  header: Header read from the flash.
+ * @retval uint8_t: 1 for a valid header.
+ */
+static uint8_t FTL_IsValid (const FTL_SectorHeader_t* header)
+{
+  return header->magic == FTL_SECTOR_MAGIC && header->logical < FTL_LOGICAL_SECTORS
+      && header->check == FTL_HeaderCheck (header);
+}
+
+/**
+ * @brief  Find a free physical sector.
+ * @param  mostWorn: 0 for the lowest erase count, 1 for the highest one.
+ * @retval uint16_t: Physical sector, FTL_NO_SECTOR if there is none.
+ */
+static uint16_t FTL_FindFree (uint8_t mostWorn)
+{
+  uint16_t found = FTL_NO_SECTOR;
+
+  for (uint16_t i = 0; i < sectorCount; i++)
+  {
+    uint16_t sector = (allocCursor + i) % sectorCount;
+
+    if (FTL_IsUsed (sector)) continue;
+    if (found == FTL_NO_SECTOR
+	|| (mostWorn ? eraseCount[sector] > eraseCount[found] : eraseCount[sector] < eraseCount[found]))
+      found = sector;
+  }
+  return found;
+}
+
+/**
+ * @brief  Erase a physical sector and program the first part of its header.
+ * @param  sector: Free physical sector.
+ * @param  logical: Logical sector to be stored.
+ * @retval None
+ */
+static void FTL_PrepareSector (uint16_t sector, uint16_t logical)
+{
+  FTL_SectorHeader_t header;
+
+  Flash_SErase4k (FTL_SectorAddress (sector));
+  eraseCount[sector]++;
+
+  header.eraseCount = eraseCount[sector];
+  header.version = nextVersion++;
+  header.logical = logical;
+  header.check = FTL_HeaderCheck (&header);
+  header.magic = FTL_EMPTY_WORD;
+  Flash_Write (FTL_SectorAddress (sector), (uint8_t*) &header, sizeof(header));
+}
+
+/**
+ * @brief  Program the magic number of a prepared sector and make it the current copy.
+ * @param  sector: Physical sector holding the complete data.
+ * @param  logical: Logical sector stored in it.
+ * @retval None
+ */
+static void FTL_CommitSector (uint16_t sector, uint16_t logical)
+{
+  uint32_t magic = FTL_SECTOR_MAGIC;
+
+  Flash_Write (FTL_SectorAddress (sector) + offsetof(FTL_SectorHeader_t, magic), (uint8_t*) &magic, sizeof(magic));
+
+  if (sectorMap[logical] != FTL_NO_SECTOR) FTL_SetUsed (sectorMap[logical], 0);
+  sectorMap[logical] = sector;
+  FTL_SetUsed (sector, 1);
+  allocCursor = (sector + 1) % sectorCount;
+}
+
+/**
+ * @brief  Move the logical sector stored on the least worn sector to the most worn free one.
+ * @retval None
+ *
+ * Called after every write, at most one sector is moved at a time.
+ */
+static void FTL_LevelStatic (void)
+{
+  uint16_t coldLogical = FTL_NO_SECTOR;
+  uint16_t worn = FTL_FindFree (1);
+  uint8_t chunk[FTL_COPY_CHUNK];
+
+  if (worn == FTL_NO_SECTOR) return;
+
+  for (uint16_t logical = 0; logical < FTL_LOGICAL_SECTORS; logical++)
+  {
+    if (sectorMap[logical] == FTL_NO_SECTOR) continue;
+    if (coldLogical == FTL_NO_SECTOR || eraseCount[sectorMap[logical]] < eraseCount[sectorMap[coldLogical]])
+      coldLogical = logical;
+  }
+  if (coldLogical == FTL_NO_SECTOR || eraseCount[worn] < eraseCount[sectorMap[coldLogical]] + FTL_STATIC_THRESHOLD) return;
+
+  uint32_t source = FTL_SectorAddress (sectorMap[coldLogical]) + sizeof(FTL_SectorHeader_t);
+  uint32_t destination = FTL_SectorAddress (worn) + sizeof(FTL_SectorHeader_t);
+
+  FTL_PrepareSector (worn, coldLogical);
+  for (uint32_t offset = 0; offset < FTL_DATA_SIZE; offset += FTL_COPY_CHUNK)
+  {
+    uint32_t size = (FTL_DATA_SIZE - offset < FTL_COPY_CHUNK) ? FTL_DATA_SIZE - offset : FTL_COPY_CHUNK;
+
+    Flash_Read (source + offset, chunk, size);
+    Flash_Write (destination + offset, chunk, size);
+  }
+  FTL_CommitSector (worn, coldLogical);
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+/**
+ * @brief  Rebuild the map and the erase counts from the sector headers.
+ * @retval uint8_t: 1 if the partition fits on the chip.
+ *
+ * Every physical sector costs one 16 byte read. Sectors with no erase count in the
+ * header were never used, or lost it in a power cut right after the erase.
+ * Only headers passing the check are trusted, an interrupted erase can leave
+ * any bit pattern behind.
+ * The flash must be initialized before.
+ */
+uint8_t FTL_Mount (void)
+{
+  FTL_SectorHeader_t header, current;
+
+  isMounted = 1;
+  isWriting = 0;
+  nextVersion = 0;
+  allocCursor = 0;
+  memset (sectorMap, 0xFF, sizeof(sectorMap));
+  memset (usedMap, 0, sizeof(usedMap));
+
+  sectorCount = 0;
+  if (Flash_GetSize () < FTL_START_ADDRESS + FTL_PHYSICAL_SECTORS * FTL_SECTOR_SIZE) return 0;
+  sectorCount = FTL_PHYSICAL_SECTORS;
+
+  uint64_t countSum = 0;
+  uint16_t countKnown = 0;
+
+  for (uint16_t sector = 0; sector < sectorCount; sector++)
+  {
+    Flash_Read (FTL_SectorAddress (sector), (uint8_t*) &header, sizeof(header));
+    eraseCount[sector] = FTL_EMPTY_WORD;
+    if (header.eraseCount == FTL_EMPTY_WORD) eraseCount[sector] = 0;
+    if (header.check != FTL_HeaderCheck (&header)) continue;
+
+    eraseCount[sector] = header.eraseCount;
+    countSum += header.eraseCount;
+    countKnown++;
+    if (header.version >= nextVersion) nextVersion = header.version + 1;
+    if (!FTL_IsValid (&header)) continue;
+
+    // Keep the newest copy, the older one is free
+    uint16_t previous = sectorMap[header.logical];
+    if (previous != FTL_NO_SECTOR)
+    {
+      Flash_Read (FTL_SectorAddress (previous), (uint8_t*) &current, sizeof(current));
+      if (current.version > header.version) continue;
+      FTL_SetUsed (previous, 0);
+    }
+    sectorMap[header.logical] = sector;
+    FTL_SetUsed (sector, 1);
+  }
+
+  // A header garbled by an interrupted erase gets the average count
+  for (uint16_t sector = 0; sector < sectorCount; sector++)
+    if (eraseCount[sector] == FTL_EMPTY_WORD) eraseCount[sector] = countKnown ? countSum / countKnown : 0;
+  return 1;
+}
+
+/**
+ * @brief  Start writing a new copy of a logical sector.
+ * @param  logical: Logical sector (0 - FTL_LOGICAL_SECTORS-1).
+ * @retval uint8_t: 1 if a free sector was prepared.
+ *
+ * The data is passed with FTL_WriteData() and becomes visible after FTL_EndWrite().
+ * Until then reads return the previous copy.
+ */
+uint8_t FTL_BeginWrite (uint16_t logical)
+{
+  if (!isMounted) FTL_Mount ();
+  if (isWriting || logical >= FTL_LOGICAL_SECTORS) return 0;
+
+  writeSector = FTL_FindFree (0);
+  if (writeSector == FTL_NO_SECTOR) return 0;
+
+  FTL_PrepareSector (writeSector, logical);
+  writeLogical = logical;
+  writeOffset = 0;
+  isWriting = 1;
+  return 1;
+}
+
+/**
+ * @brief  Append data to the copy opened by FTL_BeginWrite().
+ * @param  data: Data to be written.
+ * @param  size: Number of bytes, the sector holds FTL_DATA_SIZE bytes.
+ * @retval uint8_t: 1 on success, 0 if the data doesn't fit.
+ */
+uint8_t FTL_WriteData (const void* data, uint32_t size)
+{
+  if (!isWriting || writeOffset + size > FTL_DATA_SIZE) return 0;
+
+  Flash_Write (FTL_SectorAddress (writeSector) + sizeof(FTL_SectorHeader_t) + writeOffset, (uint8_t*) data, size);
+  writeOffset += size;
+  return 1;
+}
+
+/**
+ * @brief  Complete the copy opened by FTL_BeginWrite().
+ * @retval uint8_t: 1 on success.
+ *
+ * The previous copy becomes free, then the static levelling may move one cold sector.
+ */
+uint8_t FTL_EndWrite (void)
+{
+  if (!isWriting) return 0;
+
+  FTL_CommitSector (writeSector, writeLogical);
+  isWriting = 0;
+  FTL_LevelStatic ();
+  return 1;
+}
+
+/**
+ * @brief  Replace the content of a logical sector.
+ * @param  logical: Logical sector (0 - FTL_LOGICAL_SECTORS-1).
+ * @param  data: Data to be written.
+ * @param  size: Number of bytes, up to FTL_DATA_SIZE.
+ * @retval uint8_t: 1 on success.
+ */
+uint8_t FTL_Write (uint16_t logical, const void* data, uint32_t size)
+{
+  if (size > FTL_DATA_SIZE || !FTL_BeginWrite (logical)) return 0;
+
+  FTL_WriteData (data, size);
+  return FTL_EndWrite ();
+}
+
+/**
+ * @brief  Read from the current copy of a logical sector.
+ * @param  logical: Logical sector (0 - FTL_LOGICAL_SECTORS-1).
+ * @param  offset: Offset within the sector data.
+ * @param  data: Buffer to be filled.
+ * @param  size: Number of bytes.
+ * @retval uint8_t: 1 on success, 0 if the sector was never written.
+ */
+uint8_t FTL_Read (uint16_t logical, uint32_t offset, void* data, uint32_t size)
+{
+  uint32_t address;
+
+  if (offset + size > FTL_DATA_SIZE || !FTL_GetDataAddress (logical, &address)) return 0;
+
+  Flash_Read (address + offset, (uint8_t*) data, size);
+  return 1;
+}
+
+/**
+ * @brief  Get the flash address of the data of a logical sector.
+ * @param  logical: Logical sector (0 - FTL_LOGICAL_SECTORS-1).
+ * @param  address: Pointer where the address will be stored.
+ * @retval uint8_t: 1 on success, 0 if the sector was never written.
+ *
+ * Allows DMA reads straight from the flash. The address is valid until the next write.
+ */
+uint8_t FTL_GetDataAddress (uint16_t logical, uint32_t* address)
+{
+  if (!isMounted) FTL_Mount ();
+  if (logical >= FTL_LOGICAL_SECTORS || sectorMap[logical] == FTL_NO_SECTOR) return 0;
+
+  *address = FTL_SectorAddress (sectorMap[logical]) + sizeof(FTL_SectorHeader_t);
+  return 1;
+}
+
+/**
+ * @brief  Get the lowest and the highest erase count of the partition.
+ * @param  minCount: Pointer where the lowest count will be stored.
+ * @param  maxCount: Pointer where the highest count will be stored.
+ * @retval uint8_t: 1 on success, 0 if the chip has no room for the partition.
+ */
+uint8_t FTL_GetEraseCountRange (uint32_t* minCount, uint32_t* maxCount)
+{
+  if (!isMounted) FTL_Mount ();
+  if (sectorCount == 0) return 0;
+
+  *minCount = *maxCount = eraseCount[0];
+  for (uint16_t sector = 1; sector < sectorCount; sector++)
+  {
+    if (eraseCount[sector] < *minCount) *minCount = eraseCount[sector];
+    if (eraseCount[sector] > *maxCount) *maxCount = eraseCount[sector];
+  }
+  return 1;
+}
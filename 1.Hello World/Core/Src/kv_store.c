@@ -0,0 +1,304 @@
+/*
+ * kv_store.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ *
+ *  This file implements a log-structured key-value store in the external flash.
+ *  Writing a value appends an entry to the active sector, the newest entry of a key wins.
+ *  When the active sector is full, the current values are copied to the next sector
+ *  of the ring, which then becomes active: the sectors are erased in turn.
+ *
+ *  At mount the active sector is found from the sector headers and its entries are
+ *  read with one sequential read into the index in RAM. Reads are served from the index,
+ *  a write only programs its entry. An entry which fails its check, left by a write
+ *  interrupted by a power loss, is skipped.
+ */
+
+#include "kv_store.h"
+#include "z_flash_W25QXXX.h"
+#include "string.h"
+
+// ============================================================================
+// Definitions and Constants
+// ============================================================================
+
+#define KV_EMPTY_KEY		0xFFFF     // Key of an erased entry header
+#define KV_NO_SECTOR		0xFF       // No active sector, the store is empty
+
+/* Size of an entry with a value of the given length */
+#define KV_ENTRY_SIZE(length)	(sizeof(KV_EntryHeader_t) + (((length) + 3) & ~3))
+
+// ============================================================================
+// Types
+// ============================================================================
+
+typedef struct
+{
+  uint16_t key;
+  uint8_t length;
+  uint8_t value[KV_MAX_VALUE_SIZE];
+} KV_Item_t;
+
+// ============================================================================
+// Private Variables
+// ============================================================================
+
+static uint8_t isMounted = 0;
+static KV_Item_t items[KV_MAX_KEYS];   // Current values
+static uint8_t itemCount = 0;
+static uint8_t activeSector = KV_NO_SECTOR;
+static uint32_t activeSequence;
+static uint32_t writeOffset;           // Free space of the active sector starts here
+
+// ============================================================================
+// Static Helper Functions
+// ============================================================================
+
+/**
+ * @brief  Get the flash address of a sector of the ring.
+ * @param  sector: Sector index (0..KV_SECTOR_COUNT-1).
+ * @retval uint32_t: Address of the sector header.
+ */
+static uint32_t KV_SectorAddress (uint8_t sector)
+{
+  return KV_START_ADDRESS + (uint32_t) sector * KV_SECTOR_SIZE;
+}
+
+/**
+ * @brief  Compute the check of an entry.
+ * @param  key: Key of the entry.
+ * @param  value: Value of the entry.
+ * @param  length: Length of the value.
+ * @retval uint8_t: Check value.
+ */
+static uint8_t KV_Check (uint16_t key, const uint8_t* value, uint8_t length)
+{
+  uint32_t check = key * 31 + length;
+
+  for (uint8_t i = 0; i < length; i++)
+    check = check * 31 + value[i];
+
+  check ^= check >> 16;
+  check ^= check >> 8;
+  return (uint8_t) check;
+}
+
+/**
+ * @brief  Find a key in the index.
+ * @param  key: Key to look for.
+ * @retval KV_Item_t*: Item of the key, NULL if the key is not stored.
+ */
+static KV_Item_t* KV_FindItem (uint16_t key)
+{
+  for (uint8_t i = 0; i < itemCount; i++)
+    if (items[i].key == key) return &items[i];
+
+  return NULL;
+}
+
+/**
+ * @brief  Store a value in the index.
+ * @param  key: Key of the value.
+ * @param  value: Value, ignored when the length is 0.
+ * @param  length: Length of the value, 0 removes the key.
+ * @retval uint8_t: 1 on success, 0 if the index is full.
+ */
+static uint8_t KV_UpdateIndex (uint16_t key, const uint8_t* value, uint8_t length)
+{
+  KV_Item_t* item = KV_FindItem (key);
+
+  if (length == 0)
+  {
+    // Keep the table packed, the last item takes the place of the removed one
+    if (item != NULL) *item = items[--itemCount];
+    return 1;
+  }
+
+  if (item == NULL)
+  {
+    if (itemCount == KV_MAX_KEYS) return 0;
+    item = &items[itemCount++];
+    item->key = key;
+  }
+  item->length = length;
+  memcpy (item->value, value, length);
+  return 1;
+}
+
+/**
+ * @brief  Program one entry at the given address.
+ * @param  address: Flash address of the entry.
+ * @param  key: Key of the entry.
+ * @param  value: Value of the entry.
+ * @param  length: Length of the value.
+ * @retval None
+ *
+ * The header and the value are programmed together, a single page program
+ * unless the entry crosses a page boundary.
+ */
+static void KV_WriteEntry (uint32_t address, uint16_t key, const uint8_t* value, uint8_t length)
+{
+  uint8_t buffer[KV_ENTRY_SIZE(KV_MAX_VALUE_SIZE)];
+  KV_EntryHeader_t* header = (KV_EntryHeader_t*) buffer;
+
+  memset (buffer, 0xFF, sizeof(buffer));
+  header->key = key;
+  header->length = length;
+  header->check = KV_Check (key, value, length);
+  if (length > 0) memcpy (buffer + sizeof(KV_EntryHeader_t), value, length);
+
+  Flash_Write (address, buffer, KV_ENTRY_SIZE(length));
+}
+
+/**
+ * @brief  Copy the current values to the next sector of the ring and make it active.
+ * @retval None
+ *
+ * The previous sector stays active until the magic number of the new one is programmed.
+ */
+static void KV_Compact (void)
+{
+  uint8_t sector = (activeSector == KV_NO_SECTOR) ? 0 : (activeSector + 1) % KV_SECTOR_COUNT;
+  uint32_t address = KV_SectorAddress (sector);
+  KV_SectorHeader_t header;
+
+  Flash_SErase4k (address);
+
+  header.magic = KV_SECTOR_MAGIC;
+  header.sequence = activeSequence + 1;
+  header.check = ~header.sequence;
+  Flash_Write (address + sizeof(header.magic), (uint8_t*) &header.sequence, sizeof(header) - sizeof(header.magic));
+
+  writeOffset = sizeof(KV_SectorHeader_t);
+  for (uint8_t i = 0; i < itemCount; i++)
+  {
+    KV_WriteEntry (address + writeOffset, items[i].key, items[i].value, items[i].length);
+    writeOffset += KV_ENTRY_SIZE(items[i].length);
+  }
+
+  Flash_Write (address, (uint8_t*) &header.magic, sizeof(header.magic));
+  activeSector = sector;
+  activeSequence = header.sequence;
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+/**
+ * @brief  Locate the active sector and load its values into RAM.
+ * @retval uint8_t: 1 on success, 0 if the chip is too small for the store.
+ *
+ * Called by the other functions when needed. The entries are read with a single
+ * sequential read, an entry with a broken header ends the sector: the next write
+ * compacts it.
+ */
+uint8_t KV_Mount (void)
+{
+  KV_SectorHeader_t header;
+
+  if (Flash_GetSize () < KV_START_ADDRESS + KV_SECTOR_COUNT * KV_SECTOR_SIZE) return 0;
+
+  isMounted = 1;
+  itemCount = 0;
+  activeSector = KV_NO_SECTOR;
+  activeSequence = 0;
+  writeOffset = KV_SECTOR_SIZE;
+
+  for (uint8_t sector = 0; sector < KV_SECTOR_COUNT; sector++)
+  {
+    Flash_Read (KV_SectorAddress (sector), (uint8_t*) &header, sizeof(header));
+    if (header.magic != KV_SECTOR_MAGIC || header.check != ~header.sequence) continue;
+
+    if (activeSector == KV_NO_SECTOR || header.sequence > activeSequence)
+    {
+      activeSector = sector;
+      activeSequence = header.sequence;
+    }
+  }
+  if (activeSector == KV_NO_SECTOR) return 1;
+
+  Flash_StartRead (KV_SectorAddress (activeSector) + sizeof(KV_SectorHeader_t));
+  writeOffset = sizeof(KV_SectorHeader_t);
+  while (writeOffset + KV_ENTRY_SIZE(0) <= KV_SECTOR_SIZE)
+  {
+    KV_EntryHeader_t entry;
+    uint8_t value[KV_ENTRY_SIZE(KV_MAX_VALUE_SIZE)];
+
+    Flash_ContinueRead ((uint8_t*) &entry, sizeof(entry));
+    if (entry.key == KV_EMPTY_KEY) break;
+
+    if (entry.length > KV_MAX_VALUE_SIZE || writeOffset + KV_ENTRY_SIZE(entry.length) > KV_SECTOR_SIZE)
+    {
+      writeOffset = KV_SECTOR_SIZE;
+      break;
+    }
+
+    Flash_ContinueRead (value, KV_ENTRY_SIZE(entry.length) - sizeof(entry));
+    writeOffset += KV_ENTRY_SIZE(entry.length);
+    if (entry.check == KV_Check (entry.key, value, entry.length))
+      KV_UpdateIndex (entry.key, value, entry.length);
+  }
+  Flash_EndRead ();
+  return 1;
+}
+
+/**
+ * @brief  Read a value.
+ * @param  key: Key of the value.
+ * @param  value: Buffer where the value will be stored.
+ * @param  size: Size of the buffer, a longer value is truncated.
+ * @retval uint8_t: Length of the stored value, 0 if the key is not stored.
+ */
+uint8_t KV_Get (uint16_t key, void* value, uint8_t size)
+{
+  if (!isMounted && !KV_Mount ()) return 0;
+
+  KV_Item_t* item = KV_FindItem (key);
+  if (item == NULL) return 0;
+
+  memcpy (value, item->value, (item->length < size) ? item->length : size);
+  return item->length;
+}
+
+/**
+ * @brief  Store a value.
+ * @param  key: Key of the value (not 0xFFFF).
+ * @param  value: Value to be stored.
+ * @param  length: Length of the value (1..KV_MAX_VALUE_SIZE), 0 deletes the key.
+ * @retval uint8_t: 1 on success, 0 on invalid arguments or when KV_MAX_KEYS keys are stored.
+ *
+ * Nothing is written when the value doesn't change.
+ */
+uint8_t KV_Set (uint16_t key, const void* value, uint8_t length)
+{
+  if (!isMounted && !KV_Mount ()) return 0;
+  if (key == KV_EMPTY_KEY || length > KV_MAX_VALUE_SIZE) return 0;
+
+  KV_Item_t* item = KV_FindItem (key);
+  if (length == 0 && item == NULL) return 1;
+  if (item != NULL && item->length == length && memcmp (item->value, value, length) == 0) return 1;
+  if (!KV_UpdateIndex (key, value, length)) return 0;
+
+  if (writeOffset + KV_ENTRY_SIZE(length) > KV_SECTOR_SIZE)
+  {
+    // The new value is already in the index, the compaction writes it
+    KV_Compact ();
+    return 1;
+  }
+
+  KV_WriteEntry (KV_SectorAddress (activeSector) + writeOffset, key, value, length);
+  writeOffset += KV_ENTRY_SIZE(length);
+  return 1;
+}
+
+/**
+ * @brief  Delete a value.
+ * @param  key: Key of the value.
+ * @retval uint8_t: 1 on success, 0 if the store is not available.
+ */
+uint8_t KV_Delete (uint16_t key)
+{
+  return KV_Set (key, NULL, 0);
+}
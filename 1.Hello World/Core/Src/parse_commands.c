@@ -1,309 +1,529 @@
-/*
- * parse_commands.c
- *
- *  Created on: Jul 16, 2024
- *      Author: piotr
- */
-
-// IMPORTANT: Communication was required to test different scenarios involving time changes.
-// Afterward, debug mode was no longer needed. Furthermore, USB CDC interrupts caused issues
-// with UART communication, so it was temporarily disabled.
-
-#include "main.h"
-#include "rtc.h"
-#include "ring_buffer.h"
-#include "parse_commands.h"
-#include "string.h"
-#include "stdio.h"
-#include "stdlib.h"
-#include "bmp280.h"
-#include "NEO_6M.h"
-#include "local_time.h"
-
-extern BMP280_t Bmp280;
-extern GPSGetDataState GPSDataState;
-
-extern RTC_HandleTypeDef hrtc;
-
-//
-// Get a one complete line from Ring Buffer
-//
-void Parser_TakeLine(RingBuffer_t *Buf, uint8_t *Destination)
-{
-	uint8_t Tmp;
-	uint8_t i = 0;
-
-	// Loop for every char in Ring Buffer
-	do
-	{
-		// Read a one byte from Ring Buffer
-		RB_Read(Buf, &Tmp);
-
-		// Check if we take the endline char
-		if(Tmp == ENDLINE)
-		{
-			// If endline - replace it with c-string end sign - 0x00
-			Destination[i] = 0;
-		}
-		else
-		{
-			// If not endline - just write to work-buffer
-			Destination[i] = Tmp;
-		}
-
-		i++; // increment array iterator
-	}while(Tmp != ENDLINE); // If we hit the endline char - end the loop
-}
-
-
-
-// Parsing functions
-// Commands:
-
-// BMP280 GET_TEMP
-// BMP280 GET_HUM
-// BMP280 GET_PRESS
-// BMP280 DEBUG_MODE_ON
-// BMP280 DEBUG_MODE_OFF
-
-// GPS SLEEP
-// GPS WAKEUP
-// GPS SEND_CONFIG
-// GPS GET_DATA
-// GPS DEBUG_MODE_ON
-// GPS DEBUG_MODE_OFF
-
-// TIME GET
-// TIME SET_TIME H=%2d M=%2d S=%2d
-// TIME SET_DATE D=%2d M=%2d Y=%2d
-// TIME SET_UTC_TIME D=%2d MO=%2d Y=%2d H=%2d MI=%2d S=%2d
-// TIME DEBUG_MODE_ON
-// TIME DEBUG_MODE_OFF
-
-
-static void Parser_ParseBMP280 (void)
-{
-  // String to parse:
-  // GET_TEMP
-  // GET_HUM
-  // GET_PRESS
-  // DEBUG_MODE_ON
-  // DEBUG_MODE_OFF
-
-  // Pointer to sub-string
-  char ParsePointer[16];
-
-  strcpy ((char*) ParsePointer, strtok (NULL, ","));
-
-  if (strlen (ParsePointer) > 0) // Check if string exists
-    {
-      // Check what to do
-      if (strncmp (ParsePointer, "GET_TEMP", 8) == 0)
-	{
-	  float temp = BMP280_ReadTemperature (&Bmp280);
-	  printf ("Temperature = %.1f\r\n", temp);
-	}
-      else if (strncmp (ParsePointer, "GET_HUM", 7) == 0)
-	{
-	  float tempT, tempP, tempH;
-	  BMP280_ReadSensorData (&Bmp280, &tempP, &tempT, &tempH);
-	  printf ("Humidity = %.1f\r\n", tempH);
-	}
-      else if (strncmp (ParsePointer, "GET_PRESS", 9) == 0)
-	{
-	  float tempT, tempP, tempH;
-	  BMP280_ReadSensorData (&Bmp280, &tempP, &tempT, &tempH);
-	  printf ("Pressure = %.1f\r\n", tempP);
-	}
-      else if (strncmp (ParsePointer, "DEBUG_MODE_ON", 13) == 0)
-	{
-	  //TODO
-	}
-      else if (strncmp (ParsePointer, "DEBUG_MODE_OFF", 14) == 0)
-	{
-	  //TODO
-	}
-    }
-}
-
-static void Parser_ParseGPS(void)
-{
-  // String to parse:
-  //  SLEEP
-  //  WAKEUP
-  //  SEND_CONFIG
-  //  GET_DATA
-  //  DEBUG_MODE_ON
-  //  DEBUG_MODE_OFF
-
-    // Pointer to sub-string
-    char ParsePointer[16];
-
-    strcpy ((char*) ParsePointer, strtok (NULL, ","));
-
-    if (strlen (ParsePointer) > 0) // Check if string exists
-      {
-        // Check what to do
-        if (strncmp (ParsePointer, "SLEEP", 5) == 0)
-  	{
-            GPS_Sleep ();
-  	}
-        else if (strncmp (ParsePointer, "WAKEUP", 6) == 0)
-  	{
-            GPS_Wakeup ();
-  	}
-        else if (strncmp (ParsePointer, "SEND_CONFIG", 11) == 0)
-  	{
-            GPS_SendCommands();
-  	}
-        else if (strncmp (ParsePointer, "GET_DATA", 8) == 0)
-	{
-            GPSDataState = WAITING_FOR_DATA;
-	}
-        else if (strncmp (ParsePointer, "DEBUG_MODE_ON", 13) == 0)
-  	{
-  	  //TODO
-  	}
-        else if (strncmp (ParsePointer, "DEBUG_MODE_OFF", 14) == 0)
-  	{
-  	  //TODO
-  	}
-      }
-}
-
-static void Parser_ParseTIME(void)
-{
-  //  GET
-  // SET_TIME H=%2d M=%2d S=%2d
-  // SET_DATE D=%2d M=%2d Y=%2d
-  // SET_UTC_TIME D=%2d MO=%2d Y=%2d H=%2d MI=%2d S=%2d
-  // DEBUG_MODE_ON
-  // DEBUG_MODE_OFF
-
-    // Pointer to sub-string
-    char ParsePointer[64];
-
-    strcpy ((char*) ParsePointer, strtok (NULL, ","));
-
-    if (strlen (ParsePointer) > 0) // Check if string exists
-      {
-        // Check what to do
-      if (strncmp (ParsePointer, "GET", 3) == 0)
-	{
-	  RTC_TimeTypeDef sTime = { 0 };
-	  HAL_RTC_GetTime (&hrtc, &sTime, RTC_FORMAT_BIN);
-	  RTC_DateTypeDef sDate = { 0 };
-	  HAL_RTC_GetDate (&hrtc, &sDate, RTC_FORMAT_BIN);
-	  printf (
-	      "Current date and time: %02d-%02d-%04d Time: %02d:%02d:%02d\n\r",
-	      sDate.Date, sDate.Month, sDate.Year + 2000, sTime.Hours,
-	      sTime.Minutes, sTime.Seconds);
-	}
-      else if (strncmp (ParsePointer, "SET_TIME", 8) == 0)
-	{
-	  RTC_TimeTypeDef sTime = { 0 };
-	  int h, m, s;
-	  if (sscanf ( ParsePointer, "SET_TIME H=%2d M=%2d S=%2d",
-		      &h, &m, &s) == 3)
-	    {
-	      sTime.Hours = (uint8_t)h;
-	      sTime.Minutes = (uint8_t)m;
-	      sTime.Seconds = (uint8_t)s;
-	      HAL_RTC_SetTime (&hrtc, &sTime, RTC_FORMAT_BIN);
-	    }
-	  else
-	    {
-	      sTime.Hours = 0;
-	      sTime.Minutes = 0;
-	      sTime.Seconds = 0;
-	      HAL_RTC_SetTime (&hrtc, &sTime, RTC_FORMAT_BIN);
-	    }
-	}
-      else if (strncmp (ParsePointer, "SET_DATE", 8) == 0)
-	{
-	  RTC_DateTypeDef sDate = { 0 };
-	  int d, m, y;
-	  if (sscanf (ParsePointer, "SET_DATE D=%2d M=%2d Y=%2d",
-		      &d, &m, &y) == 3)
-	    {
-	      sDate.WeekDay = 0;
-	      sDate.Date = (uint8_t)d;
-	      sDate.Month = (uint8_t)m;
-	      sDate.Year = (uint8_t)y;
-	      HAL_RTC_SetDate (&hrtc, &sDate, RTC_FORMAT_BIN);
-	    }
-	  else
-	    {
-	      sDate.WeekDay = 0;
-	      sDate.Date = 0;
-	      sDate.Month = 0;
-	      sDate.Year = 0;
-	      HAL_RTC_SetDate (&hrtc, &sDate, RTC_FORMAT_BIN);
-	    }
-	}
-      else if (strncmp (ParsePointer, "SET_UTC_TIME", 8) == 0)
-      	{
-      	  DateTime datetime = { 0 };
-      	  int d, mo, y, h, mi, s;
-      	  if (sscanf ( ParsePointer, "SET_UTC_TIME D=%2d MO=%2d Y=%2d H=%2d MI=%2d S=%2d",
-      		      &d, &mo, &y, &h, &mi, &s) == 6)
-      	    {
-      	      datetime.hour = h;
-	      datetime.minute =  mi;
-	      datetime.second = s;
-	      datetime.day = d;
-	      datetime.month =  mo;
-	      datetime.year = (y + 2000);
-      	      LT_SetTime(&hrtc, &datetime);
-      	    }
-      	  else
-      	    {
-	      datetime.hour = 0;
-	      datetime.minute = 0;
-	      datetime.second = 0;
-	      datetime.day = 0;
-	      datetime.month = 0;
-	      datetime.year = 0;
-	      LT_SetTime(&hrtc, &datetime);
-      	    }
-      	}
-      else if (strncmp (ParsePointer, "DEBUG_MODE_ON", 13) == 0)
-  	{
-  	  //TODO
-  	}
-        else if (strncmp (ParsePointer, "DEBUG_MODE_OFF", 14) == 0)
-  	{
-  	  //TODO
-  	}
-      }
-}
-
-// Main parsing function
-// Commands to detect:
-// 	BMP280
-// 	GPS
-//
-//
-void Parser_Parse (uint8_t *DataToParse)
-{
-  // Pointer to sub-string
-  char *ParsePointer = strtok ((char*) DataToParse, " "); // Create a sub-string
-
-  // Compare provided array with line to parse with command template
-  if (strcmp ("BMP280", ParsePointer) == 0)
-    {
-      Parser_ParseBMP280 (); // Call a parsing function for the BMP280 command
-    }
-  else if (strcmp ("GPS", ParsePointer) == 0)
-    {
-      Parser_ParseGPS (); // Call a parsing function for the GPS command
-    }
-  else if (strcmp ("TIME", ParsePointer) == 0)
-    {
-      Parser_ParseTIME (); // Call a parsing function for the TIME command
-    }
-  else
-    printf ("Problem with parsing\r\n");
-
-}
-
+/*
+ * parse_commands.c
+ *
+ *  Created on: Jul 16, 2024
+ *      Author: piotr
+ */
+
+// IMPORTANT: Communication was required to test different scenarios involving time changes.
+// Afterward, debug mode was no longer needed. Furthermore, USB CDC interrupts caused issues
+// with UART communication, so it was temporarily disabled.
+
+#include "main.h"
+#include "rtc.h"
+#include "ring_buffer.h"
+#include "parse_commands.h"
+#include "string.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "bmp280.h"
+#include "NEO_6M.h"
+#include "local_time.h"
+#include "sample_log.h"
+#include "z_flash_W25QXXX.h"
+#include "ftl.h"
+#include "led_ws2812b.h"
+
+extern BMP280_t Bmp280;
+extern GPSGetDataState GPSDataState;
+
+extern RTC_HandleTypeDef hrtc;
+
+extern int _write (int file, char *ptr, int len);
+
+// Binary export of the sample log, see Parser_ParseLOG()
+#define EXPORT_FRAME_MAGIC	0x58454C53 // "SLEX"
+#define EXPORT_CHUNK_SIZE	256        // Bytes read from the flash and sent at once
+
+typedef struct
+{
+  uint32_t magic;	// EXPORT_FRAME_MAGIC
+  uint32_t sequence;	// Sequence number of the log sector, or the next one to ask for in the end frame
+  uint16_t length;	// Payload length, 0 in the end frame
+  uint16_t reserved;
+} ExportFrameHeader_t;
+
+//
+// Get a one complete line from Ring Buffer
+//
+void Parser_TakeLine(RingBuffer_t *Buf, uint8_t *Destination)
+{
+	uint8_t Tmp;
+	uint8_t i = 0;
+
+	// Loop for every char in Ring Buffer
+	do
+	{
+		// Read a one byte from Ring Buffer
+		RB_Read(Buf, &Tmp);
+
+		// Check if we take the endline char
+		if(Tmp == ENDLINE)
+		{
+			// If endline - replace it with c-string end sign - 0x00
+			Destination[i] = 0;
+		}
+		else
+		{
+			// If not endline - just write to work-buffer
+			Destination[i] = Tmp;
+		}
+
+		i++; // increment array iterator
+	}while(Tmp != ENDLINE); // If we hit the endline char - end the loop
+}
+
+
+
+// Parsing functions
+// Commands:
+
+// BMP280 GET_TEMP
+// BMP280 GET_HUM
+// BMP280 GET_PRESS
+// BMP280 DEBUG_MODE_ON
+// BMP280 DEBUG_MODE_OFF
+
+// GPS SLEEP
+// GPS WAKEUP
+// GPS SEND_CONFIG
+// GPS GET_DATA
+// GPS DEBUG_MODE_ON
+// GPS DEBUG_MODE_OFF
+
+// TIME GET
+// TIME SET_TIME H=%2d M=%2d S=%2d
+// TIME SET_DATE D=%2d M=%2d Y=%2d
+// TIME SET_UTC_TIME D=%2d MO=%2d Y=%2d H=%2d MI=%2d S=%2d
+// TIME DEBUG_MODE_ON
+// TIME DEBUG_MODE_OFF
+
+// LOG EXPORT FROM=%lu
+// LOG STATS FROM=%lu TO=%lu
+
+// LED BENCHMARK
+
+
+static void Parser_ParseBMP280 (void)
+{
+  // String to parse:
+  // GET_TEMP
+  // GET_HUM
+  // GET_PRESS
+  // DEBUG_MODE_ON
+  // DEBUG_MODE_OFF
+
+  // Pointer to sub-string
+  char ParsePointer[16];
+
+  strcpy ((char*) ParsePointer, strtok (NULL, ","));
+
+  if (strlen (ParsePointer) > 0) // Check if string exists
+    {
+      // Check what to do
+      if (strncmp (ParsePointer, "GET_TEMP", 8) == 0)
+	{
+	  float temp = BMP280_ReadTemperature (&Bmp280);
+	  printf ("Temperature = %.1f\r\n", temp);
+	}
+      else if (strncmp (ParsePointer, "GET_HUM", 7) == 0)
+	{
+	  float tempT, tempP, tempH;
+	  BMP280_ReadSensorData (&Bmp280, &tempP, &tempT, &tempH);
+	  printf ("Humidity = %.1f\r\n", tempH);
+	}
+      else if (strncmp (ParsePointer, "GET_PRESS", 9) == 0)
+	{
+	  float tempT, tempP, tempH;
+	  BMP280_ReadSensorData (&Bmp280, &tempP, &tempT, &tempH);
+	  printf ("Pressure = %.1f\r\n", tempP);
+	}
+      else if (strncmp (ParsePointer, "DEBUG_MODE_ON", 13) == 0)
+	{
+	  //TODO
+	}
+      else if (strncmp (ParsePointer, "DEBUG_MODE_OFF", 14) == 0)
+	{
+	  //TODO
+	}
+    }
+}
+
+static void Parser_ParseGPS(void)
+{
+  // String to parse:
+  //  SLEEP
+  //  WAKEUP
+  //  SEND_CONFIG
+  //  GET_DATA
+  //  DEBUG_MODE_ON
+  //  DEBUG_MODE_OFF
+
+    // Pointer to sub-string
+    char ParsePointer[16];
+
+    strcpy ((char*) ParsePointer, strtok (NULL, ","));
+
+    if (strlen (ParsePointer) > 0) // Check if string exists
+      {
+        // Check what to do
+        if (strncmp (ParsePointer, "SLEEP", 5) == 0)
+  	{
+            GPS_Sleep ();
+  	}
+        else if (strncmp (ParsePointer, "WAKEUP", 6) == 0)
+  	{
+            GPS_Wakeup ();
+  	}
+        else if (strncmp (ParsePointer, "SEND_CONFIG", 11) == 0)
+  	{
+            GPS_SendCommands();
+  	}
+        else if (strncmp (ParsePointer, "GET_DATA", 8) == 0)
+	{
+            GPSDataState = WAITING_FOR_DATA;
+	}
+        else if (strncmp (ParsePointer, "DEBUG_MODE_ON", 13) == 0)
+  	{
+  	  //TODO
+  	}
+        else if (strncmp (ParsePointer, "DEBUG_MODE_OFF", 14) == 0)
+  	{
+  	  //TODO
+  	}
+      }
+}
+
+static void Parser_ParseTIME(void)
+{
+  //  GET
+  // SET_TIME H=%2d M=%2d S=%2d
+  // SET_DATE D=%2d M=%2d Y=%2d
+  // SET_UTC_TIME D=%2d MO=%2d Y=%2d H=%2d MI=%2d S=%2d
+  // DEBUG_MODE_ON
+  // DEBUG_MODE_OFF
+
+    // Pointer to sub-string
+    char ParsePointer[64];
+
+    strcpy ((char*) ParsePointer, strtok (NULL, ","));
+
+    if (strlen (ParsePointer) > 0) // Check if string exists
+      {
+        // Check what to do
+      if (strncmp (ParsePointer, "GET", 3) == 0)
+	{
+	  RTC_TimeTypeDef sTime = { 0 };
+	  HAL_RTC_GetTime (&hrtc, &sTime, RTC_FORMAT_BIN);
+	  RTC_DateTypeDef sDate = { 0 };
+	  HAL_RTC_GetDate (&hrtc, &sDate, RTC_FORMAT_BIN);
+	  printf (
+	      "Current date and time: %02d-%02d-%04d Time: %02d:%02d:%02d\n\r",
+	      sDate.Date, sDate.Month, sDate.Year + 2000, sTime.Hours,
+	      sTime.Minutes, sTime.Seconds);
+	}
+      else if (strncmp (ParsePointer, "SET_TIME", 8) == 0)
+	{
+	  RTC_TimeTypeDef sTime = { 0 };
+	  int h, m, s;
+	  if (sscanf ( ParsePointer, "SET_TIME H=%2d M=%2d S=%2d",
+		      &h, &m, &s) == 3)
+	    {
+	      sTime.Hours = (uint8_t)h;
+	      sTime.Minutes = (uint8_t)m;
+	      sTime.Seconds = (uint8_t)s;
+	      HAL_RTC_SetTime (&hrtc, &sTime, RTC_FORMAT_BIN);
+	    }
+	  else
+	    {
+	      sTime.Hours = 0;
+	      sTime.Minutes = 0;
+	      sTime.Seconds = 0;
+	      HAL_RTC_SetTime (&hrtc, &sTime, RTC_FORMAT_BIN);
+	    }
+	}
+      else if (strncmp (ParsePointer, "SET_DATE", 8) == 0)
+	{
+	  RTC_DateTypeDef sDate = { 0 };
+	  int d, m, y;
+	  if (sscanf (ParsePointer, "SET_DATE D=%2d M=%2d Y=%2d",
+		      &d, &m, &y) == 3)
+	    {
+	      sDate.WeekDay = 0;
+	      sDate.Date = (uint8_t)d;
+	      sDate.Month = (uint8_t)m;
+	      sDate.Year = (uint8_t)y;
+	      HAL_RTC_SetDate (&hrtc, &sDate, RTC_FORMAT_BIN);
+	    }
+	  else
+	    {
+	      sDate.WeekDay = 0;
+	      sDate.Date = 0;
+	      sDate.Month = 0;
+	      sDate.Year = 0;
+	      HAL_RTC_SetDate (&hrtc, &sDate, RTC_FORMAT_BIN);
+	    }
+	}
+      else if (strncmp (ParsePointer, "SET_UTC_TIME", 8) == 0)
+      	{
+      	  DateTime datetime = { 0 };
+      	  int d, mo, y, h, mi, s;
+      	  if (sscanf ( ParsePointer, "SET_UTC_TIME D=%2d MO=%2d Y=%2d H=%2d MI=%2d S=%2d",
+      		      &d, &mo, &y, &h, &mi, &s) == 6)
+      	    {
+      	      datetime.hour = h;
+	      datetime.minute =  mi;
+	      datetime.second = s;
+	      datetime.day = d;
+	      datetime.month =  mo;
+	      datetime.year = (y + 2000);
+      	      LT_SetTime(&hrtc, &datetime);
+      	    }
+      	  else
+      	    {
+	      datetime.hour = 0;
+	      datetime.minute = 0;
+	      datetime.second = 0;
+	      datetime.day = 0;
+	      datetime.month = 0;
+	      datetime.year = 0;
+	      LT_SetTime(&hrtc, &datetime);
+      	    }
+      	}
+      else if (strncmp (ParsePointer, "DEBUG_MODE_ON", 13) == 0)
+  	{
+  	  //TODO
+  	}
+        else if (strncmp (ParsePointer, "DEBUG_MODE_OFF", 14) == 0)
+  	{
+  	  //TODO
+  	}
+      }
+}
+
+//
+// Update a CRC-32 (same as zlib) with a block of data
+//
+static uint32_t Parser_Crc32 (uint32_t crc, const uint8_t *data, uint32_t length)
+{
+  crc = ~crc;
+  while (length--)
+    {
+      crc ^= *data++;
+      for (uint8_t bit = 0; bit < 8; bit++)
+	crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  return ~crc;
+}
+
+//
+// Send raw bytes to the host, bypassing printf formatting.
+// CDC_Transmit_FS() only starts the transfer: the data must stay unchanged until
+// the next call, which waits while the previous transfer is busy.
+//
+static void Parser_SendBinary (const void *data, uint16_t length)
+{
+  fflush (stdout);
+  _write (1, (char*) data, length);
+}
+
+//
+// Send all sectors of the sample log starting with a given sequence number.
+// Every sector goes out as one frame: header, raw sector content read straight
+// from the flash, CRC-32 of the header and the content. The end frame has no payload
+// and carries the sequence number to resume from. The head sector is still being
+// written, so it is always the one sent again by a resumed export.
+// Records are decoded on the host, see Tools/slog_export.py.
+// The chunks are read alternately into two buffers, so a chunk is not overwritten
+// while it is still being sent. The header and the CRC are static for the same reason.
+//
+static void Parser_ExportLog (uint32_t fromSequence)
+{
+  static ExportFrameHeader_t header = { EXPORT_FRAME_MAGIC, 0, 0, 0 };
+  static uint32_t crc;
+  static uint8_t chunks[2][EXPORT_CHUNK_SIZE];
+  uint32_t oldest, newest, address;
+  uint8_t chunkIndex = 0;
+
+  if (SLOG_GetSequenceRange (&oldest, &newest))
+    {
+      if (fromSequence < oldest) fromSequence = oldest;
+
+      for (uint32_t sequence = fromSequence; sequence <= newest; sequence++)
+	{
+	  if (!SLOG_GetSectorAddress (sequence, &address)) break;
+
+	  header.sequence = sequence;
+	  header.length = SLOG_SECTOR_SIZE;
+	  Parser_SendBinary (&header, sizeof(header));
+	  crc = Parser_Crc32 (0, (uint8_t*) &header, sizeof(header));
+
+	  for (uint32_t offset = 0; offset < SLOG_SECTOR_SIZE; offset += EXPORT_CHUNK_SIZE)
+	    {
+	      uint8_t *chunk = chunks[chunkIndex];
+
+	      Flash_Read (address + offset, chunk, EXPORT_CHUNK_SIZE);
+	      Parser_SendBinary (chunk, EXPORT_CHUNK_SIZE);
+	      crc = Parser_Crc32 (crc, chunk, EXPORT_CHUNK_SIZE);
+	      chunkIndex ^= 1;
+	    }
+	  Parser_SendBinary (&crc, sizeof(crc));
+	}
+      fromSequence = newest;
+    }
+
+  // End frame, the CRC of the last sector is sent before the header, so it can be changed
+  header.sequence = fromSequence;
+  header.length = 0;
+  Parser_SendBinary (&header, sizeof(header));
+  crc = Parser_Crc32 (0, (uint8_t*) &header, sizeof(header));
+  Parser_SendBinary (&crc, sizeof(crc));
+}
+
+static void Parser_ParseLOG(void)
+{
+  // EXPORT FROM=%lu
+  // STATS FROM=%lu TO=%lu
+
+    // Pointer to sub-string
+    char ParsePointer[48];
+
+    strcpy ((char*) ParsePointer, strtok (NULL, ","));
+
+    if (strlen (ParsePointer) > 0) // Check if string exists
+      {
+	// Check what to do
+	if (strncmp (ParsePointer, "EXPORT", 6) == 0)
+	  {
+	    unsigned long from;
+	    if (sscanf (ParsePointer, "EXPORT FROM=%lu", &from) != 1)
+	      {
+		from = 0; // Whole log
+	      }
+	    Parser_ExportLog ((uint32_t) from);
+	  }
+	else if (strncmp (ParsePointer, "STATS", 5) == 0)
+	  {
+	    unsigned long from, to;
+	    if (sscanf (ParsePointer, "STATS FROM=%lu TO=%lu", &from, &to) != 2)
+	      {
+		from = 0; // Whole log
+		to = 0xFFFFFFFF;
+	      }
+
+	    SLOG_Stats_t stats;
+	    if (SLOG_GetStats ((uint32_t) from, (uint32_t) to, &stats) == 0)
+	      {
+		printf ("No records\r\n");
+	      }
+	    else
+	      {
+		printf ("Records = %lu\r\n", (unsigned long) stats.count);
+		printf ("Temperature = %.2f - %.2f, mean %.2f\r\n", stats.min[0], stats.max[0], stats.mean[0]);
+		printf ("Humidity = %.2f - %.2f, mean %.2f\r\n", stats.min[1], stats.max[1], stats.mean[1]);
+		printf ("Pressure = %.2f - %.2f, mean %.2f\r\n", stats.min[2], stats.max[2], stats.mean[2]);
+		printf ("Battery = %.0f - %.0f, mean %.1f\r\n", stats.min[3], stats.max[3], stats.mean[3]);
+	      }
+	  }
+      }
+}
+
+static void Parser_ParseFLASH(void)
+{
+  // STATS
+
+    // Pointer to sub-string
+    char ParsePointer[32];
+
+    strcpy ((char*) ParsePointer, strtok (NULL, ","));
+
+    if (strlen (ParsePointer) > 0) // Check if string exists
+      {
+	// Check what to do
+	if (strncmp (ParsePointer, "STATS", 5) == 0)
+	  {
+	    FlashPowerStats stats;
+	    Flash_GetPowerStats (&stats);
+	    printf ("Flash wake-ups = %lu, powered time = %lu ms\r\n",
+		    (unsigned long) stats.wakeUps, (unsigned long) stats.poweredTime);
+
+	    uint32_t hits, misses;
+	    Flash_GetCacheStats (&hits, &misses);
+	    printf ("Flash cache hits = %lu, misses = %lu\r\n", (unsigned long) hits, (unsigned long) misses);
+
+	    uint32_t minErases, maxErases;
+	    if (FTL_GetEraseCountRange (&minErases, &maxErases))
+	      {
+		printf ("FTL erase counts = %lu - %lu\r\n", (unsigned long) minErases, (unsigned long) maxErases);
+	      }
+	  }
+      }
+}
+
+static void Parser_ParseLED(void)
+{
+  // BENCHMARK
+
+    // Pointer to sub-string
+    char ParsePointer[32];
+
+    strcpy ((char*) ParsePointer, strtok (NULL, ","));
+
+    if (strlen (ParsePointer) > 0) // Check if string exists
+      {
+	// Check what to do
+	if (strncmp (ParsePointer, "BENCHMARK", 9) == 0)
+	  {
+	    uint32_t bitwiseCycles, tableCycles;
+	    uint8_t isEqual = LED_Benchmark (&bitwiseCycles, &tableCycles);
+	    printf ("LED encoder cycles per LED: bitwise = %lu, table = %lu, %s\r\n", (unsigned long) bitwiseCycles,
+		    (unsigned long) tableCycles, isEqual ? "output equal" : "OUTPUT DIFFERS");
+	  }
+      }
+}
+
+// Main parsing function
+// Commands to detect:
+// 	BMP280
+// 	GPS
+// 	TIME
+// 	LOG
+// 	FLASH
+// 	LED
+//
+//
+void Parser_Parse (uint8_t *DataToParse)
+{
+  // Pointer to sub-string
+  char *ParsePointer = strtok ((char*) DataToParse, " "); // Create a sub-string
+
+  // Compare provided array with line to parse with command template
+  if (strcmp ("BMP280", ParsePointer) == 0)
+    {
+      Parser_ParseBMP280 (); // Call a parsing function for the BMP280 command
+    }
+  else if (strcmp ("GPS", ParsePointer) == 0)
+    {
+      Parser_ParseGPS (); // Call a parsing function for the GPS command
+    }
+  else if (strcmp ("TIME", ParsePointer) == 0)
+    {
+      Parser_ParseTIME (); // Call a parsing function for the TIME command
+    }
+  else if (strcmp ("LOG", ParsePointer) == 0)
+    {
+      Parser_ParseLOG (); // Call a parsing function for the LOG command
+    }
+  else if (strcmp ("FLASH", ParsePointer) == 0)
+    {
+      Parser_ParseFLASH (); // Call a parsing function for the FLASH command
+    }
+  else if (strcmp ("LED", ParsePointer) == 0)
+    {
+      Parser_ParseLED (); // Call a parsing function for the LED command
+    }
+  else
+    printf ("Problem with parsing\r\n");
+
+}
+
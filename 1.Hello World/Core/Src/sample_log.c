@@ -0,0 +1,1260 @@
+/*
+ * sample_log.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ *
+ *  This file implements an append-only log of chart samples in the external flash.
+ *  The log is a ring of 4 KB sectors. Each sector begins with a header holding
+ *  a sequence number and the first record of the sector, so the newest sector can be
+ *  located with a binary search over the headers when the MCU boots.
+ *
+ *  Records are compressed. Values are stored as fixed point numbers and every record
+ *  after the header one is encoded as a bit packed difference to the previous record:
+ *  delta-of-delta for the timestamp, plain delta for the sensor values. A record taken
+ *  10 minutes after the previous one with slowly changing values needs about 5 bytes
+ *  instead of 32. Each sector can be decoded on its own, starting from its header.
+ *
+ *  When a sector is full, a footer with the summary of its records (count, last timestamp,
+ *  minimum, maximum and sum of every value) is written at its end. Statistics over
+ *  a time range are taken from the footers of the sectors lying completely inside the range,
+ *  only the sectors at its edges have to be decoded.
+ *
+ *  The ring spans SLOG_PARTITION_SIZE bytes, or less on a smaller chip, so it can hold
+ *  years of samples. Nothing is kept in RAM per sector: a time range query seeks to the
+ *  first matching sector with a binary search over the sector headers, then decodes
+ *  the sectors with sequential reads and delivers only matching records.
+ *  Records are assumed to be appended in chronological order.
+ *
+ *  New records don't go to the flash right away. They are queued in the RTC backup
+ *  registers, which survive standby, and written as one burst when the queue is full
+ *  or when the log is read. Most wake-ups which save a sample don't touch the flash at all.
+ *
+ *  The sector following the head is erased in advance, in the background, while the main
+ *  loop runs (see Flash_Process()). Opening a new head sector then only checks that it is
+ *  blank, so no append waits for an erase. The ring holds one sector of history less.
+ */
+
+#include "sample_log.h"
+#include "string.h"
+#include "stddef.h"
+
+// ============================================================================
+// Definitions and Constants
+// ============================================================================
+
+#define SLOG_EMPTY_WORD		0xFFFFFFFF // Content of an erased flash word
+#define SLOG_STREAM_CHUNK	64         // Bytes fetched per chunk of a sequential read
+#define SLOG_STREAM_SIZE	(SLOG_SECTOR_SIZE - sizeof(SLOG_SectorHeader_t) - sizeof(SLOG_SectorFooter_t))
+#define SLOG_STREAM_BITS	(SLOG_STREAM_SIZE * 8)
+#define SLOG_MAX_RECORD_BITS	185        // Start bit, longest codes of the timestamp and all values, check bits
+#define SLOG_CHECK_BITS		4          // Check bits closing every record
+#define SLOG_NOMINAL_INTERVAL	600        // Expected distance between records, in seconds
+#define SLOG_FOOTER_MAGIC	0x4D4D5553 // "SUMM", written last so a torn footer is not used
+#define SLOG_BLANK_CHUNK	256        // Bytes read per step of a blank check
+
+/*
+ * Write-behind queue in the RTC backup registers: a header register (magic, count, check)
+ * followed by three registers per record: epoch, temperature and humidity (16 bits each),
+ * pressure (24 bits) and battery level (8 bits), all in the fixed point of the log.
+ */
+#define SLOG_QUEUE_REGISTER	RTC_BKP_DR4 // Header register, records follow up to RTC_BKP_DR19
+#define SLOG_QUEUE_SIZE		5          // Records held by the queue
+#define SLOG_QUEUE_WORDS	3          // Registers per record
+#define SLOG_QUEUE_MAGIC	0x5153     // "SQ"
+
+/*
+ * Every record in the stream begins with a 0 bit. Erased flash reads as 1,
+ * so the first 1 in place of a start bit marks the end of the stream.
+ */
+#define SLOG_RECORD_START_BIT	0
+
+/* Fixed point scale of the values, in the order of SLOG_SectorHeader_t.first_values */
+static const uint16_t valueScale[SLOG_VALUE_COUNT] =
+{ 100, 100, 100, 1 };
+
+/*
+ * Variable length codes: a prefix of N one bits terminated by a zero bit (the last
+ * prefix has no terminator) selects the number of payload bits from the table.
+ * Payloads are zigzag encoded signed numbers.
+ */
+#define SLOG_CODE_COUNT		5
+static const uint8_t timestampCodeBits[SLOG_CODE_COUNT] =
+{ 0, 7, 9, 12, 32 };
+static const uint8_t valueCodeBits[SLOG_CODE_COUNT] =
+{ 0, 5, 8, 12, 32 };
+
+// ============================================================================
+// Types
+// ============================================================================
+
+/*
+ * State of the decoder, equal to the last record decoded or encoded
+ */
+typedef struct
+{
+  uint32_t epoch;
+  int32_t delta;                       // Distance between the last two timestamps
+  int32_t value[SLOG_VALUE_COUNT];     // Fixed point values
+} SLOG_State_t;
+
+/*
+ * Sequential bit reader over one sector, fed by a flash read in progress
+ */
+typedef struct
+{
+  uint8_t buffer[SLOG_STREAM_CHUNK];
+  uint16_t byteCount;                  // Valid bytes in the buffer
+  uint16_t byteIndex;                  // Byte currently being read
+  uint8_t bitIndex;                    // Next bit of the current byte, 0 = MSB
+  uint16_t bytesLeft;                  // Bytes of the sector stream not fetched yet
+  uint32_t bitsLeft;                   // Bits of the sector stream not read yet
+  uint8_t isBroken;                    // Set when the stream ends inside a damaged record
+} SLOG_Reader_t;
+
+/*
+ * Bit writer for one encoded record
+ */
+typedef struct
+{
+  uint8_t buffer[SLOG_QUEUE_SIZE * SLOG_MAX_RECORD_BITS / 8 + 2]; // Room for a flush of the whole queue
+  uint16_t bitCount;                   // Bits written, including the offset of the first byte
+} SLOG_Writer_t;
+
+/*
+ * Summary of a group of records, in fixed point
+ */
+typedef struct
+{
+  uint32_t count;
+  uint32_t lastEpoch;
+  int32_t min[SLOG_VALUE_COUNT];
+  int32_t max[SLOG_VALUE_COUNT];
+  int64_t sum[SLOG_VALUE_COUNT];
+} SLOG_Summary_t;
+
+/*
+ * Function called for every decoded record of a sector scan
+ */
+typedef void (*SLOG_StateCallback_t) (const SLOG_State_t* state, void* context);
+
+/*
+ * Context of SLOG_ReadRange() passed through a sector scan
+ */
+typedef struct
+{
+  SLOG_RecordCallback_t callback;
+  void* context;
+  uint32_t delivered;
+} SLOG_RangeReader_t;
+
+// ============================================================================
+// Static Variables
+// ============================================================================
+
+static uint8_t isMounted = 0;      // Set after the head of the log has been located
+static uint32_t logEnd;            // End of the log area (exclusive)
+static uint32_t sectorCount;       // Number of sectors in the ring
+static uint8_t isEmpty = 1;        // No record has been written yet
+static uint32_t headSector;        // Index of the sector currently being appended to
+static uint32_t headSequence;      // Sequence number of the head sector
+
+/* Write position in the head sector, found by decoding it before it is first needed */
+static uint8_t isHeadLoaded = 0;   // Set after the head sector has been decoded
+static uint32_t headBits;          // Bits used in the stream of the head sector
+static uint8_t headLastByte;       // Content of the partially written last byte
+static SLOG_State_t headState;     // Last record of the head sector
+static SLOG_Summary_t headSummary; // Summary of the head sector, written to its footer when it is closed
+static uint8_t isNextErased = 0;   // Set when the erase of the sector after the head has been queued
+
+/* Sectors which can be searched by a range query */
+static uint8_t isIndexed = 0;      // Set after indexSectors has been found
+static uint32_t indexSectors;      // Number of consecutive sectors ending with the head
+
+// ============================================================================
+// Static Helper Functions
+// ============================================================================
+
+/**
+ * @brief  Get the flash address of a sector of the log.
+ * @param  sector: Sector index (0..sectorCount-1).
+ * @retval uint32_t: Address of the first byte of the sector.
+ */
+static uint32_t SLOG_SectorAddress (uint32_t sector)
+{
+  return SLOG_START_ADDRESS + sector * SLOG_SECTOR_SIZE;
+}
+
+/**
+ * @brief  Get the flash address of the compressed stream of a sector.
+ * @param  sector: Sector index.
+ * @retval uint32_t: Address of the first byte after the header.
+ */
+static uint32_t SLOG_StreamAddress (uint32_t sector)
+{
+  return SLOG_SectorAddress (sector) + sizeof(SLOG_SectorHeader_t);
+}
+
+/**
+ * @brief  Get the flash address of the footer of a sector.
+ * @param  sector: Sector index.
+ * @retval uint32_t: Address of the footer at the end of the sector.
+ */
+static uint32_t SLOG_FooterAddress (uint32_t sector)
+{
+  return SLOG_SectorAddress (sector) + SLOG_SECTOR_SIZE - sizeof(SLOG_SectorFooter_t);
+}
+
+/**
+ * @brief  Read the header of a sector and check that it belongs to the log.
+ * @param  sector: Sector index.
+ * @param  header: Pointer where the header will be stored.
+ * @retval uint8_t: 1 if the header is valid, 0 otherwise.
+ */
+static uint8_t SLOG_ReadHeader (uint32_t sector, SLOG_SectorHeader_t* header)
+{
+  Flash_Read (SLOG_SectorAddress (sector), (uint8_t*) header, sizeof(SLOG_SectorHeader_t));
+
+  return (header->magic == SLOG_SECTOR_MAGIC && header->sequence != SLOG_EMPTY_WORD);
+}
+
+/**
+ * @brief  Check if a sector continues the sequence started by a reference sector.
+ * @param  sector: Sector index to test.
+ * @param  refSector: Index of a valid sector that precedes it.
+ * @param  refSequence: Sequence number of the reference sector.
+ * @retval uint8_t: 1 if the sector was written in the same lap as the reference one.
+ */
+static uint8_t SLOG_IsInSequence (uint32_t sector, uint32_t refSector, uint32_t refSequence)
+{
+  SLOG_SectorHeader_t header;
+
+  if (!SLOG_ReadHeader (sector, &header)) return 0;
+  return header.sequence == refSequence + (sector - refSector);
+}
+
+/**
+ * @brief  Convert a position in the index to a physical sector number.
+ * @param  position: 0 for the oldest indexed sector, indexSectors-1 for the head.
+ * @retval uint32_t: Sector index.
+ */
+static uint32_t SLOG_IndexToSector (uint32_t position)
+{
+  return (headSector + sectorCount - (indexSectors - 1 - position)) % sectorCount;
+}
+
+/**
+ * @brief  Check if the sector k places behind the head belongs to the same sequence.
+ * @param  k: Distance from the head sector.
+ * @retval uint8_t: 1 if the sector holds valid records older than the head.
+ */
+static uint8_t SLOG_PrecedesHead (uint32_t k)
+{
+  SLOG_SectorHeader_t header;
+  uint32_t sector = (headSector + sectorCount - k) % sectorCount;
+
+  if (!SLOG_ReadHeader (sector, &header)) return 0;
+  return header.sequence == headSequence - k;
+}
+
+/**
+ * @brief  Find how many sectors, ending with the head, belong to the log.
+ * @retval None
+ *
+ * Going back from the head, sectors continue the sequence until the oldest one of the ring
+ * or the first sector that was never written, so the boundary is found with a binary search.
+ * The sector after the head is left out while its erase is queued: its header can't be
+ * trusted until the erase has finished.
+ */
+static void SLOG_BuildIndex (void)
+{
+  isIndexed = 1;
+  indexSectors = 0;
+
+  if (isEmpty) return;
+
+  uint32_t low = 1, high = isNextErased ? sectorCount - 1 : sectorCount;
+  while (low < high)
+  {
+    uint32_t mid = (low + high + 1) / 2;
+
+    if (SLOG_PrecedesHead (mid - 1)) low = mid;
+    else high = mid - 1;
+  }
+  indexSectors = low;
+}
+
+/**
+ * @brief  Check if a sector of the log is erased.
+ * @param  sector: Sector index.
+ * @retval uint8_t: 1 if every byte of the sector reads 0xFF.
+ *
+ * Reading a sector is much shorter than erasing it, so it pays off when the sector
+ * was probably erased in advance before a reset.
+ */
+static uint8_t SLOG_IsSectorBlank (uint32_t sector)
+{
+  uint32_t buffer[SLOG_BLANK_CHUNK / 4];
+
+  for (uint32_t offset = 0; offset < SLOG_SECTOR_SIZE; offset += SLOG_BLANK_CHUNK)
+  {
+    Flash_Read (SLOG_SectorAddress (sector) + offset, (uint8_t*) buffer, SLOG_BLANK_CHUNK);
+    for (uint8_t i = 0; i < SLOG_BLANK_CHUNK / 4; i++)
+      if (buffer[i] != SLOG_EMPTY_WORD) return 0;
+  }
+  return 1;
+}
+
+/**
+ * @brief  Update the number of searchable sectors after a new head sector was opened.
+ * @retval None
+ */
+static void SLOG_UpdateIndex (void)
+{
+  if (!isIndexed) return;
+
+  // The new head replaces the oldest sector once the whole ring is used
+  if (indexSectors < sectorCount) indexSectors++;
+}
+
+// ============================================================================
+// Record Encoding
+// ============================================================================
+
+/**
+ * @brief  Convert the values of a record to fixed point.
+ * @param  record: Record to be stored.
+ * @param  value: Table filled with the fixed point values.
+ * @retval None
+ */
+static void SLOG_Quantize (const CHARTS_t* record, int32_t* value)
+{
+  float source[SLOG_VALUE_COUNT] =
+  { record->temperature, record->humidity, record->pressure, record->battery_level };
+
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    float scaled = source[i] * valueScale[i];
+    value[i] = (int32_t) (scaled + ((scaled >= 0) ? 0.5f : -0.5f));
+  }
+}
+
+/**
+ * @brief  Build a record from the decoder state.
+ * @param  state: Decoder state.
+ * @param  record: Record to be filled.
+ * @retval None
+ */
+static void SLOG_StateToRecord (const SLOG_State_t* state, CHARTS_t* record)
+{
+  memset (record, 0, sizeof(CHARTS_t));
+  record->epoch_seconds = state->epoch;
+  record->temperature = (float) state->value[0] / valueScale[0];
+  record->humidity = (float) state->value[1] / valueScale[1];
+  record->pressure = (float) state->value[2] / valueScale[2];
+  record->battery_level = (float) state->value[3] / valueScale[3];
+}
+
+/**
+ * @brief  Initialize the decoder state from the header of a sector.
+ * @param  header: Sector header holding the first record.
+ * @param  state: Decoder state to be initialized.
+ * @retval None
+ */
+static void SLOG_HeaderToState (const SLOG_SectorHeader_t* header, SLOG_State_t* state)
+{
+  state->epoch = header->first_epoch;
+  state->delta = SLOG_NOMINAL_INTERVAL;
+  memcpy (state->value, header->first_values, sizeof(state->value));
+}
+
+/**
+ * @brief  Calculate the check bits of a record.
+ * @param  state: Decoder state after the record.
+ * @retval uint32_t: Check value, SLOG_CHECK_BITS wide.
+ *
+ * A record damaged by a power loss during programming decodes to different
+ * values, so it is detected with a probability of 15/16.
+ */
+static uint32_t SLOG_Checksum (const SLOG_State_t* state)
+{
+  uint32_t check = state->epoch;
+
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+    check = check * 31 + (uint32_t) state->value[i];
+
+  check ^= check >> 16;
+  check ^= check >> 8;
+  check ^= check >> 4;
+  return check & ((1 << SLOG_CHECK_BITS) - 1);
+}
+
+/**
+ * @brief  Append bits to the writer, most significant bit first.
+ * @param  writer: Bit writer.
+ * @param  bits: Value holding the bits in its lowest part.
+ * @param  count: Number of bits (0..32).
+ * @retval None
+ */
+static void SLOG_WriteBits (SLOG_Writer_t* writer, uint32_t bits, uint8_t count)
+{
+  while (count--)
+  {
+    // Erased flash holds ones, so only zero bits have to be programmed
+    if (((bits >> count) & 1) == 0)
+      writer->buffer[writer->bitCount / 8] &= ~(0x80 >> (writer->bitCount % 8));
+    writer->bitCount++;
+  }
+}
+
+/**
+ * @brief  Append a signed number with the shortest fitting variable length code.
+ * @param  writer: Bit writer.
+ * @param  number: Number to be encoded.
+ * @param  codeBits: Payload sizes of the code.
+ * @retval None
+ */
+static void SLOG_WriteCode (SLOG_Writer_t* writer, int32_t number, const uint8_t* codeBits)
+{
+  uint32_t zigzag = ((uint32_t) number << 1) ^ (uint32_t) (number >> 31);
+  uint8_t code = 0;
+
+  while (code < SLOG_CODE_COUNT - 1 && zigzag >= (1UL << codeBits[code]))
+    code++;
+
+  // Prefix: one bit per code step, terminated by zero except for the last code
+  SLOG_WriteBits (writer, 0xFFFFFFFF, code);
+  if (code < SLOG_CODE_COUNT - 1) SLOG_WriteBits (writer, 0, 1);
+  SLOG_WriteBits (writer, zigzag, codeBits[code]);
+}
+
+/**
+ * @brief  Encode a record as the difference to the decoder state and update the state.
+ * @param  writer: Bit writer, positioned where the record starts.
+ * @param  state: State of the previous record, updated to the new one.
+ * @param  record: Record to be encoded.
+ * @retval None
+ */
+static void SLOG_EncodeRecord (SLOG_Writer_t* writer, SLOG_State_t* state, const CHARTS_t* record)
+{
+  int32_t value[SLOG_VALUE_COUNT];
+  int32_t delta = (int32_t) (record->epoch_seconds - state->epoch);
+
+  SLOG_Quantize (record, value);
+
+  SLOG_WriteBits (writer, SLOG_RECORD_START_BIT, 1);
+  SLOG_WriteCode (writer, delta - state->delta, timestampCodeBits);
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+    SLOG_WriteCode (writer, value[i] - state->value[i], valueCodeBits);
+
+  state->epoch = record->epoch_seconds;
+  state->delta = delta;
+  memcpy (state->value, value, sizeof(state->value));
+
+  SLOG_WriteBits (writer, SLOG_Checksum (state), SLOG_CHECK_BITS);
+}
+
+// ============================================================================
+// Sector Summaries
+// ============================================================================
+
+/**
+ * @brief  Clear a summary.
+ * @param  summary: Summary to be cleared.
+ * @retval None
+ */
+static void SLOG_ResetSummary (SLOG_Summary_t* summary)
+{
+  memset (summary, 0, sizeof(SLOG_Summary_t));
+}
+
+/**
+ * @brief  Add one record to a summary.
+ * @param  state: Decoder state holding the record.
+ * @param  summary: Summary to be updated.
+ * @retval None
+ */
+static void SLOG_AddToSummary (const SLOG_State_t* state, SLOG_Summary_t* summary)
+{
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    if (summary->count == 0 || state->value[i] < summary->min[i]) summary->min[i] = state->value[i];
+    if (summary->count == 0 || state->value[i] > summary->max[i]) summary->max[i] = state->value[i];
+    summary->sum[i] += state->value[i];
+  }
+  summary->lastEpoch = state->epoch;
+  summary->count++;
+}
+
+/**
+ * @brief  Add a summary of older records to another summary.
+ * @param  source: Summary to be added.
+ * @param  summary: Summary to be updated.
+ * @retval None
+ */
+static void SLOG_MergeSummary (const SLOG_Summary_t* source, SLOG_Summary_t* summary)
+{
+  if (source->count == 0) return;
+
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    if (summary->count == 0 || source->min[i] < summary->min[i]) summary->min[i] = source->min[i];
+    if (summary->count == 0 || source->max[i] > summary->max[i]) summary->max[i] = source->max[i];
+    summary->sum[i] += source->sum[i];
+  }
+  summary->lastEpoch = source->lastEpoch;
+  summary->count += source->count;
+}
+
+/**
+ * @brief  Read the footer of a sector.
+ * @param  sector: Sector index.
+ * @param  summary: Summary filled from the footer.
+ * @retval uint8_t: 1 if the footer is valid, 0 if the sector was not closed.
+ */
+static uint8_t SLOG_ReadFooter (uint32_t sector, SLOG_Summary_t* summary)
+{
+  SLOG_SectorFooter_t footer;
+
+  Flash_Read (SLOG_FooterAddress (sector), (uint8_t*) &footer, sizeof(footer));
+  if (footer.magic != SLOG_FOOTER_MAGIC) return 0;
+
+  summary->count = footer.count;
+  summary->lastEpoch = footer.last_epoch;
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    summary->min[i] = footer.min[i];
+    summary->max[i] = footer.max[i];
+    summary->sum[i] = footer.sum[i];
+  }
+  return 1;
+}
+
+/**
+ * @brief  Close the head sector by writing the summary of its records to the footer.
+ * @retval None
+ *
+ * The bytes of a page program are not stored in a fixed order, so the magic number
+ * gets a program of its own, after the rest of the footer.
+ */
+static void SLOG_WriteFooter (void)
+{
+  SLOG_SectorFooter_t footer;
+
+  memset (&footer, 0xFF, sizeof(footer));
+  footer.count = headSummary.count;
+  footer.last_epoch = headSummary.lastEpoch;
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    footer.min[i] = headSummary.min[i];
+    footer.max[i] = headSummary.max[i];
+    footer.sum[i] = (int32_t) headSummary.sum[i];
+  }
+  Flash_Write (SLOG_FooterAddress (headSector), (uint8_t*) &footer, offsetof(SLOG_SectorFooter_t, magic));
+
+  footer.magic = SLOG_FOOTER_MAGIC;
+  Flash_Write (SLOG_FooterAddress (headSector) + offsetof(SLOG_SectorFooter_t, magic), (uint8_t*) &footer.magic,
+               sizeof(footer.magic));
+}
+
+// ============================================================================
+// Record Decoding
+// ============================================================================
+
+/**
+ * @brief  Start decoding a sector. Opens a sequential flash read.
+ * @param  reader: Bit reader to be initialized.
+ * @param  sector: Sector index.
+ * @param  header: Pointer where the sector header will be stored.
+ * @retval None
+ *
+ * The read must be closed with Flash_EndRead() once the sector is done.
+ */
+static void SLOG_OpenSector (SLOG_Reader_t* reader, uint32_t sector, SLOG_SectorHeader_t* header)
+{
+  Flash_StartRead (SLOG_SectorAddress (sector));
+  Flash_ContinueRead ((uint8_t*) header, sizeof(SLOG_SectorHeader_t));
+
+  reader->byteCount = 0;
+  reader->byteIndex = 0;
+  reader->bitIndex = 0;
+  reader->bytesLeft = SLOG_STREAM_SIZE;
+  reader->bitsLeft = SLOG_STREAM_BITS;
+  reader->isBroken = 0;
+}
+
+/**
+ * @brief  Read bits from the stream, most significant bit first.
+ * @param  reader: Bit reader.
+ * @param  count: Number of bits (0..32).
+ * @param  bits: Pointer where the value will be stored.
+ * @retval uint8_t: 1 on success, 0 if the stream ended.
+ */
+static uint8_t SLOG_ReadBits (SLOG_Reader_t* reader, uint8_t count, uint32_t* bits)
+{
+  if (count > reader->bitsLeft) return 0;
+  reader->bitsLeft -= count;
+  *bits = 0;
+
+  while (count--)
+  {
+    if (reader->byteIndex >= reader->byteCount)
+    {
+      // Fetch the next chunk, never reading past the end of the sector
+      reader->byteCount = (reader->bytesLeft < SLOG_STREAM_CHUNK) ? reader->bytesLeft : SLOG_STREAM_CHUNK;
+      reader->bytesLeft -= reader->byteCount;
+      reader->byteIndex = 0;
+      Flash_ContinueRead (reader->buffer, reader->byteCount);
+    }
+
+    *bits = (*bits << 1) | ((reader->buffer[reader->byteIndex] >> (7 - reader->bitIndex)) & 1);
+    if (++reader->bitIndex == 8)
+    {
+      reader->bitIndex = 0;
+      reader->byteIndex++;
+    }
+  }
+  return 1;
+}
+
+/**
+ * @brief  Read a signed number encoded with a variable length code.
+ * @param  reader: Bit reader.
+ * @param  codeBits: Payload sizes of the code.
+ * @param  number: Pointer where the number will be stored.
+ * @retval uint8_t: 1 on success, 0 if the stream ended.
+ */
+static uint8_t SLOG_ReadCode (SLOG_Reader_t* reader, const uint8_t* codeBits, int32_t* number)
+{
+  uint32_t bit, zigzag;
+  uint8_t code = 0;
+
+  while (code < SLOG_CODE_COUNT - 1)
+  {
+    if (!SLOG_ReadBits (reader, 1, &bit)) return 0;
+    if (bit == 0) break;
+    code++;
+  }
+  if (!SLOG_ReadBits (reader, codeBits[code], &zigzag)) return 0;
+
+  *number = (int32_t) (zigzag >> 1) ^ -(int32_t) (zigzag & 1);
+  return 1;
+}
+
+/**
+ * @brief  Decode the next record of a sector and update the decoder state.
+ * @param  reader: Bit reader.
+ * @param  state: State of the previous record, updated to the decoded one.
+ * @retval uint8_t: 1 if a record was decoded, 0 at the end of the stream.
+ *
+ * The state is left unchanged when the stream ends. A record which is cut off
+ * or fails the check also ends the stream, and marks the reader as broken.
+ */
+static uint8_t SLOG_DecodeRecord (SLOG_Reader_t* reader, SLOG_State_t* state)
+{
+  SLOG_State_t next;
+  uint32_t start, check;
+  int32_t dod, delta;
+
+  if (!SLOG_ReadBits (reader, 1, &start) || start != SLOG_RECORD_START_BIT) return 0;
+
+  reader->isBroken = 1;
+  if (!SLOG_ReadCode (reader, timestampCodeBits, &dod)) return 0;
+
+  next.delta = state->delta + dod;
+  next.epoch = state->epoch + next.delta;
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    if (!SLOG_ReadCode (reader, valueCodeBits, &delta)) return 0;
+    next.value[i] = state->value[i] + delta;
+  }
+  if (!SLOG_ReadBits (reader, SLOG_CHECK_BITS, &check) || check != SLOG_Checksum (&next)) return 0;
+  reader->isBroken = 0;
+
+  *state = next;
+  return 1;
+}
+
+/**
+ * @brief  Decode the head sector to find where the next record will be written.
+ * @retval None
+ */
+static void SLOG_LoadHead (void)
+{
+  SLOG_SectorHeader_t header;
+  SLOG_Reader_t reader;
+
+  isHeadLoaded = 1;
+  if (isEmpty) return;
+
+  SLOG_OpenSector (&reader, headSector, &header);
+  SLOG_HeaderToState (&header, &headState);
+  SLOG_ResetSummary (&headSummary);
+  SLOG_AddToSummary (&headState, &headSummary);
+  headBits = 0;
+  while (SLOG_DecodeRecord (&reader, &headState))
+  {
+    SLOG_AddToSummary (&headState, &headSummary);
+    headBits = SLOG_STREAM_BITS - reader.bitsLeft;
+  }
+  Flash_EndRead ();
+
+  // Nothing can be appended behind a damaged record, the next record opens a new sector
+  if (reader.isBroken) headBits = SLOG_STREAM_BITS;
+
+  // The last byte may be shared with the next record
+  headLastByte = 0xFF;
+  if (headBits % 8)
+    Flash_Read (SLOG_StreamAddress (headSector) + headBits / 8, &headLastByte, 1);
+}
+
+/**
+ * @brief  Find the sector where a range query starts.
+ * @param  startEpoch: First epoch second of the range.
+ * @retval uint32_t: Index position of the newest sector whose first record is not newer
+ *         than startEpoch, or of the oldest sector if all are newer.
+ */
+static uint32_t SLOG_FindSector (uint32_t startEpoch)
+{
+  uint32_t low = 0, high = indexSectors - 1;
+
+  while (low < high)
+  {
+    uint32_t mid = (low + high + 1) / 2;
+    SLOG_SectorHeader_t header;
+
+    SLOG_ReadHeader (SLOG_IndexToSector (mid), &header);
+    if (header.first_epoch <= startEpoch) low = mid;
+    else high = mid - 1;
+  }
+  return low;
+}
+
+/**
+ * @brief  Decode a sector and pass the records within a time range to a callback.
+ * @param  sector: Sector index.
+ * @param  startEpoch: First epoch second of the range (inclusive).
+ * @param  endEpoch: Last epoch second of the range (inclusive).
+ * @param  callback: Function called for every matching record.
+ * @param  context: User pointer passed to the callback.
+ * @retval uint8_t: 1 if a record newer than endEpoch was found, so later sectors can be skipped.
+ */
+static uint8_t SLOG_ScanSector (uint32_t sector, uint32_t startEpoch, uint32_t endEpoch, SLOG_StateCallback_t callback, void* context)
+{
+  SLOG_SectorHeader_t header;
+  SLOG_Reader_t reader;
+  SLOG_State_t state;
+  uint8_t isDecoded = 1, finished = 0;
+
+  SLOG_OpenSector (&reader, sector, &header);
+  SLOG_HeaderToState (&header, &state);
+
+  // The first record comes from the header, the others from the stream
+  while (isDecoded)
+  {
+    if (state.epoch > endEpoch)
+    {
+      finished = 1;
+      break;
+    }
+    if (state.epoch >= startEpoch) callback (&state, context);
+    isDecoded = SLOG_DecodeRecord (&reader, &state);
+  }
+  Flash_EndRead ();
+
+  return finished;
+}
+
+/**
+ * @brief  Sector scan callback of SLOG_ReadRange(), passes the record to the user callback.
+ * @param  state: Decoded record.
+ * @param  context: Pointer to the SLOG_RangeReader_t of the query.
+ * @retval None
+ */
+static void SLOG_DeliverRecord (const SLOG_State_t* state, void* context)
+{
+  SLOG_RangeReader_t* rangeReader = (SLOG_RangeReader_t*) context;
+  CHARTS_t record;
+
+  SLOG_StateToRecord (state, &record);
+  rangeReader->callback (&record, rangeReader->context);
+  rangeReader->delivered++;
+}
+
+/**
+ * @brief  Sector scan callback of SLOG_GetStats(), adds the record to a summary.
+ * @param  state: Decoded record.
+ * @param  context: Pointer to the SLOG_Summary_t being collected.
+ * @retval None
+ */
+static void SLOG_CollectState (const SLOG_State_t* state, void* context)
+{
+  SLOG_AddToSummary (state, (SLOG_Summary_t*) context);
+}
+
+/**
+ * @brief  Close the full head sector and open the next one of the ring.
+ * @param  record: First record of the new sector, stored in its header.
+ * @retval None
+ */
+static void SLOG_OpenHeadSector (const CHARTS_t* record)
+{
+  SLOG_SectorHeader_t header;
+
+  if (!isEmpty) SLOG_WriteFooter ();
+
+  if (isEmpty)
+  {
+    headSector = 0;
+    headSequence = 1;
+  }
+  else
+  {
+    headSector = (headSector + 1) % sectorCount;
+    headSequence++;
+  }
+
+  memset (&header, 0xFF, sizeof(header));
+  header.magic = SLOG_SECTOR_MAGIC;
+  header.sequence = headSequence;
+  header.first_epoch = record->epoch_seconds;
+  SLOG_Quantize (record, header.first_values);
+
+  // An erase queued by SLOG_PreEraseNext() is finished by Flash_Write() if still running
+  if (!isNextErased && !SLOG_IsSectorBlank (headSector)) Flash_SErase4k (SLOG_SectorAddress (headSector));
+  isNextErased = 0;
+
+  // The magic number is programmed last, a torn header leaves the sector out of the log
+  Flash_Write (SLOG_SectorAddress (headSector) + sizeof(header.magic), (uint8_t*) &header.sequence,
+               sizeof(header) - sizeof(header.magic));
+  Flash_Write (SLOG_SectorAddress (headSector), (uint8_t*) &header.magic, sizeof(header.magic));
+
+  SLOG_HeaderToState (&header, &headState);
+  SLOG_ResetSummary (&headSummary);
+  SLOG_AddToSummary (&headState, &headSummary);
+  headBits = 0;
+  headLastByte = 0xFF;
+  isEmpty = 0;
+  SLOG_UpdateIndex ();
+}
+
+/**
+ * @brief  Queue the erase of the sector which follows the head.
+ * @retval None
+ *
+ * The erase runs in the background from Flash_Process(). The sector holds the oldest records
+ * of a full ring, they are dropped from the index now. If the job queue is full, the sector
+ * is erased when it is opened instead.
+ */
+static void SLOG_PreEraseNext (void)
+{
+  if (isEmpty || isNextErased) return;
+
+  if (!Flash_QueueSErase4k (SLOG_SectorAddress ((headSector + 1) % sectorCount))) return;
+
+  isNextErased = 1;
+  if (isIndexed && indexSectors == sectorCount) indexSectors--;
+}
+
+/**
+ * @brief  Program records into the log.
+ * @param  records: Records to be stored, oldest first.
+ * @param  count: Number of records.
+ * @retval None
+ *
+ * Records that fit into the head sector are encoded one after another, right behind
+ * the previous record, and programmed together: usually a few bytes per record in a
+ * single page program. When the head sector is full its footer is written, then the
+ * next sector of the ring is programmed with a header holding the record uncompressed,
+ * and the erase of the sector after it is queued.
+ */
+static void SLOG_WriteRecords (const CHARTS_t* records, uint8_t count)
+{
+  uint8_t index = 0;
+  uint8_t isOpened = 0;
+
+  if (!isMounted) SLOG_Mount ();
+  if (!isHeadLoaded) SLOG_LoadHead ();
+
+  while (index < count)
+  {
+    if (!isEmpty && headBits + SLOG_MAX_RECORD_BITS <= SLOG_STREAM_BITS)
+    {
+      SLOG_Writer_t writer;
+      uint32_t startBits = headBits;
+
+      // Start with the partially written byte, its programmed bits are written again unchanged
+      memset (writer.buffer, 0xFF, sizeof(writer.buffer));
+      writer.buffer[0] = headLastByte;
+      writer.bitCount = headBits % 8;
+      while (index < count && headBits + SLOG_MAX_RECORD_BITS <= SLOG_STREAM_BITS)
+      {
+        uint16_t bitCount = writer.bitCount;
+
+        SLOG_EncodeRecord (&writer, &headState, &records[index++]);
+        headBits += writer.bitCount - bitCount;
+        SLOG_AddToSummary (&headState, &headSummary);
+      }
+
+      Flash_Write (SLOG_StreamAddress (headSector) + startBits / 8, writer.buffer, (writer.bitCount + 7) / 8);
+      headLastByte = (writer.bitCount % 8) ? writer.buffer[writer.bitCount / 8] : 0xFF;
+      continue;
+    }
+
+    SLOG_OpenHeadSector (&records[index++]);
+    isOpened = 1;
+  }
+
+  // Queued after the last write, Flash_Write() would wait for the erase
+  if (isOpened) SLOG_PreEraseNext ();
+}
+
+// ============================================================================
+// Write-Behind Queue
+// ============================================================================
+
+/**
+ * @brief  Calculate the check of the queue.
+ * @param  count: Number of queued records.
+ * @retval uint8_t: Check value stored in the header register.
+ */
+static uint8_t SLOG_QueueCheck (uint8_t count)
+{
+  uint32_t check = SLOG_QUEUE_MAGIC + count;
+
+  for (uint8_t i = 0; i < count * SLOG_QUEUE_WORDS; i++)
+    check = check * 31 + HAL_RTCEx_BKUPRead (&hrtc, SLOG_QUEUE_REGISTER + 1 + i);
+
+  check ^= check >> 16;
+  check ^= check >> 8;
+  return (uint8_t) check;
+}
+
+/**
+ * @brief  Read the records queued in the backup registers.
+ * @param  queue: Table filled with the queued records, SLOG_QUEUE_SIZE entries.
+ * @retval uint8_t: Number of records.
+ *
+ * Registers are 0 after a backup domain reset, which reads as an empty queue.
+ * A queue which fails the check is dropped.
+ */
+static uint8_t SLOG_ReadQueue (SLOG_State_t* queue)
+{
+  uint32_t header = HAL_RTCEx_BKUPRead (&hrtc, SLOG_QUEUE_REGISTER);
+  uint8_t count = (header >> 8) & 0xFF;
+
+  if ((header >> 16) != SLOG_QUEUE_MAGIC || count > SLOG_QUEUE_SIZE || (header & 0xFF) != SLOG_QueueCheck (count))
+  {
+    if (header != 0) HAL_RTCEx_BKUPWrite (&hrtc, SLOG_QUEUE_REGISTER, 0);
+    return 0;
+  }
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    uint32_t reg = SLOG_QUEUE_REGISTER + 1 + i * SLOG_QUEUE_WORDS;
+    uint32_t values = HAL_RTCEx_BKUPRead (&hrtc, reg + 1);
+    uint32_t pressure = HAL_RTCEx_BKUPRead (&hrtc, reg + 2);
+
+    queue[i].epoch = HAL_RTCEx_BKUPRead (&hrtc, reg);
+    queue[i].value[0] = (int16_t) (values >> 16);
+    queue[i].value[1] = (uint16_t) values;
+    queue[i].value[2] = pressure >> 8;
+    queue[i].value[3] = pressure & 0xFF;
+  }
+  return count;
+}
+
+/**
+ * @brief  Add a record to the queue in the backup registers.
+ * @param  record: Record to be queued.
+ * @retval uint8_t: 1 on success, 0 if the queue is full or a value is out of the queue format.
+ *
+ * The header register is written last, a reset before leaves the queue unchanged.
+ */
+static uint8_t SLOG_QueueRecord (const CHARTS_t* record)
+{
+  SLOG_State_t queue[SLOG_QUEUE_SIZE];
+  int32_t value[SLOG_VALUE_COUNT];
+  uint8_t count = SLOG_ReadQueue (queue);
+
+  SLOG_Quantize (record, value);
+  if (count == SLOG_QUEUE_SIZE) return 0;
+  if (value[0] < INT16_MIN || value[0] > INT16_MAX || value[1] < 0 || value[1] > UINT16_MAX) return 0;
+  if (value[2] < 0 || value[2] > 0xFFFFFF || value[3] < 0 || value[3] > 0xFF) return 0;
+
+  uint32_t reg = SLOG_QUEUE_REGISTER + 1 + count * SLOG_QUEUE_WORDS;
+
+  HAL_RTCEx_BKUPWrite (&hrtc, reg, record->epoch_seconds);
+  HAL_RTCEx_BKUPWrite (&hrtc, reg + 1, ((uint32_t) (uint16_t) value[0] << 16) | (uint16_t) value[1]);
+  HAL_RTCEx_BKUPWrite (&hrtc, reg + 2, ((uint32_t) value[2] << 8) | (uint32_t) value[3]);
+
+  count++;
+  HAL_RTCEx_BKUPWrite (&hrtc, SLOG_QUEUE_REGISTER, ((uint32_t) SLOG_QUEUE_MAGIC << 16) | (count << 8) | SLOG_QueueCheck (count));
+  return 1;
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+/**
+ * @brief  Locate the head of the log in the external flash.
+ * @retval None
+ *
+ * Sectors written during the current lap of the ring carry consecutive sequence
+ * numbers, starting at the reference sector. Sectors behind the head are either
+ * erased or come from the previous lap, so the head is the last sector which
+ * still continues the sequence. It is found with a binary search over the headers.
+ * The flash must be initialized before, the size of the ring depends on the detected chip.
+ * The head sector itself is decoded only when it is needed.
+ */
+void SLOG_Mount (void)
+{
+  SLOG_SectorHeader_t header;
+  uint32_t refSector = 0;
+
+  logEnd = SLOG_START_ADDRESS + SLOG_PARTITION_SIZE;
+  if (logEnd > Flash_GetSize ()) logEnd = Flash_GetSize ();
+  sectorCount = (logEnd - SLOG_START_ADDRESS) / SLOG_SECTOR_SIZE;
+
+  isMounted = 1;
+  isEmpty = 1;
+  isIndexed = 0;
+  isHeadLoaded = 0;
+  isNextErased = 0;
+
+  // Sector 0 can be missing only if the log is empty, or if it was erased in advance
+  // or while being reused after a wrap. In the last two cases sector 1 starts the lap.
+  if (!SLOG_ReadHeader (0, &header))
+  {
+    refSector = 1;
+    if (!SLOG_ReadHeader (refSector, &header)) return;
+  }
+
+  uint32_t refSequence = header.sequence;
+  uint32_t low = refSector, high = sectorCount - 1;
+
+  while (low < high)
+  {
+    uint32_t mid = (low + high + 1) / 2;
+
+    if (SLOG_IsInSequence (mid, refSector, refSequence)) low = mid;
+    else high = mid - 1;
+  }
+
+  headSector = low;
+  headSequence = refSequence + (low - refSector);
+  isEmpty = 0;
+}
+
+/**
+ * @brief  Append one record to the log.
+ * @param  record: Pointer to the record to be stored.
+ * @retval None
+ *
+ * The record is queued in the backup registers. A full queue is written to the flash,
+ * also when it is found full before adding the record: a flush was interrupted then.
+ * A record which doesn't fit into the compact queue format is written right away.
+ */
+void SLOG_Append (CHARTS_t* record)
+{
+  SLOG_State_t queue[SLOG_QUEUE_SIZE];
+  uint8_t count = SLOG_ReadQueue (queue);
+
+  if (count == SLOG_QUEUE_SIZE)
+  {
+    SLOG_Flush ();
+    count = 0;
+  }
+
+  if (!SLOG_QueueRecord (record))
+  {
+    SLOG_Flush ();
+    SLOG_WriteRecords (record, 1);
+    return;
+  }
+  if (count + 1 == SLOG_QUEUE_SIZE) SLOG_Flush ();
+}
+
+/**
+ * @brief  Write the records queued in the backup registers to the flash.
+ * @retval None
+ *
+ * Queued records already present in the log are skipped, so a flush interrupted by
+ * a reset is simply repeated. Called by every function reading the log.
+ */
+void SLOG_Flush (void)
+{
+  SLOG_State_t queue[SLOG_QUEUE_SIZE];
+  CHARTS_t records[SLOG_QUEUE_SIZE];
+  uint8_t count = SLOG_ReadQueue (queue);
+  uint8_t newCount = 0;
+
+  if (count == 0) return;
+
+  if (!isMounted) SLOG_Mount ();
+  if (!isHeadLoaded) SLOG_LoadHead ();
+
+  for (uint8_t i = 0; i < count; i++)
+    if (isEmpty || queue[i].epoch > headState.epoch)
+      SLOG_StateToRecord (&queue[i], &records[newCount++]);
+
+  SLOG_WriteRecords (records, newCount);
+  HAL_RTCEx_BKUPWrite (&hrtc, SLOG_QUEUE_REGISTER, 0);
+}
+
+/**
+ * @brief  Drop the records queued in the backup registers.
+ * @retval None
+ *
+ * To be called before the log is erased together with the rest of the flash,
+ * otherwise the next flush writes the old records into the empty log.
+ * The log is located again when it is next used.
+ */
+void SLOG_ClearQueue (void)
+{
+  HAL_RTCEx_BKUPWrite (&hrtc, SLOG_QUEUE_REGISTER, 0);
+  isMounted = 0;
+}
+
+/**
+ * @brief  Get a number identifying the newest record of the log.
+ * @retval uint32_t: Changes with every appended record, 0 for an empty log.
+ *
+ * Can be used as a key for data derived from the log, it changes whenever a record is added.
+ */
+uint32_t SLOG_GetRecordNumber (void)
+{
+  SLOG_Flush ();
+  if (!isMounted) SLOG_Mount ();
+  if (!isHeadLoaded) SLOG_LoadHead ();
+  if (isEmpty) return 0;
+
+  return (headSequence << 16) + headSummary.count;
+}
+
+/**
+ * @brief  Read all records within a time range.
+ * @param  startEpoch: First epoch second of the range (inclusive).
+ * @param  endEpoch: Last epoch second of the range (inclusive).
+ * @param  callback: Function called for every matching record, oldest first.
+ * @param  context: User pointer passed to the callback.
+ * @retval uint32_t: Number of records passed to the callback.
+ *
+ * The sector containing the start of the range is found with a binary search over the
+ * sector headers. From there sectors are decoded one after another, each with a single
+ * sequential read, until a record is newer than endEpoch. The callback runs while a read
+ * is in progress, so it must not access the flash itself.
+ */
+uint32_t SLOG_ReadRange (uint32_t startEpoch, uint32_t endEpoch, SLOG_RecordCallback_t callback, void* context)
+{
+  SLOG_RangeReader_t rangeReader =
+  { callback, context, 0 };
+
+  SLOG_Flush ();
+  if (!isMounted) SLOG_Mount ();
+  if (!isIndexed) SLOG_BuildIndex ();
+  if (indexSectors == 0 || startEpoch > endEpoch) return 0;
+
+  uint8_t finished = 0;
+  for (uint32_t position = SLOG_FindSector (startEpoch); position < indexSectors && !finished; position++)
+    finished = SLOG_ScanSector (SLOG_IndexToSector (position), startEpoch, endEpoch, SLOG_DeliverRecord, &rangeReader);
+
+  return rangeReader.delivered;
+}
+
+/**
+ * @brief  Calculate statistics of the records within a time range.
+ * @param  startEpoch: First epoch second of the range (inclusive).
+ * @param  endEpoch: Last epoch second of the range (inclusive).
+ * @param  stats: Pointer where the statistics will be stored.
+ * @retval uint32_t: Number of records in the range, the statistics are zero when there are none.
+ *
+ * Sectors lying completely inside the range contribute their footer, or the summary kept
+ * in RAM for the head sector, so only the sectors at the edges of the range are decoded.
+ * Even a range covering the whole log costs one header and footer read per sector.
+ */
+uint32_t SLOG_GetStats (uint32_t startEpoch, uint32_t endEpoch, SLOG_Stats_t* stats)
+{
+  SLOG_Summary_t summary;
+
+  memset (stats, 0, sizeof(SLOG_Stats_t));
+  SLOG_ResetSummary (&summary);
+
+  SLOG_Flush ();
+  if (!isMounted) SLOG_Mount ();
+  if (!isIndexed) SLOG_BuildIndex ();
+  if (!isHeadLoaded) SLOG_LoadHead ();
+  if (indexSectors == 0 || startEpoch > endEpoch) return 0;
+
+  uint8_t finished = 0;
+  for (uint32_t position = SLOG_FindSector (startEpoch); position < indexSectors && !finished; position++)
+  {
+    uint32_t sector = SLOG_IndexToSector (position);
+    SLOG_SectorHeader_t header;
+    SLOG_Summary_t sectorSummary;
+    uint8_t hasSummary = 1;
+
+    SLOG_ReadHeader (sector, &header);
+    if (header.first_epoch > endEpoch) break;
+
+    if (sector == headSector) sectorSummary = headSummary;
+    else hasSummary = SLOG_ReadFooter (sector, &sectorSummary);
+
+    if (hasSummary && header.first_epoch >= startEpoch && sectorSummary.lastEpoch <= endEpoch)
+      SLOG_MergeSummary (&sectorSummary, &summary);
+    else
+      finished = SLOG_ScanSector (sector, startEpoch, endEpoch, SLOG_CollectState, &summary);
+  }
+
+  stats->count = summary.count;
+  if (summary.count == 0) return 0;
+
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    stats->min[i] = (float) summary.min[i] / valueScale[i];
+    stats->max[i] = (float) summary.max[i] / valueScale[i];
+    stats->mean[i] = (float) summary.sum[i] / summary.count / valueScale[i];
+  }
+  return summary.count;
+}
+
+/**
+ * @brief  Get the sequence numbers of the oldest and the newest sector of the log.
+ * @param  oldestSequence: Pointer where the sequence of the oldest sector will be stored.
+ * @param  newestSequence: Pointer where the sequence of the head sector will be stored.
+ * @retval uint8_t: 1 on success, 0 if the log is empty.
+ *
+ * Sectors are identified by their sequence numbers, which never repeat,
+ * so a reader can continue from the last sector it has seen.
+ */
+uint8_t SLOG_GetSequenceRange (uint32_t* oldestSequence, uint32_t* newestSequence)
+{
+  SLOG_Flush ();
+  if (!isMounted) SLOG_Mount ();
+  if (!isIndexed) SLOG_BuildIndex ();
+  if (indexSectors == 0) return 0;
+
+  *oldestSequence = headSequence - (indexSectors - 1);
+  *newestSequence = headSequence;
+  return 1;
+}
+
+/**
+ * @brief  Get the flash address of the sector with a given sequence number.
+ * @param  sequence: Sequence number of the sector.
+ * @param  address: Pointer where the address of the sector will be stored.
+ * @retval uint8_t: 1 on success, 0 if the sector is not in the log (yet or anymore).
+ *
+ * The sector holds the header, the compressed records and, once it is full, the footer.
+ */
+uint8_t SLOG_GetSectorAddress (uint32_t sequence, uint32_t* address)
+{
+  SLOG_Flush ();
+  if (!isMounted) SLOG_Mount ();
+  if (!isIndexed) SLOG_BuildIndex ();
+  if (indexSectors == 0 || sequence > headSequence || headSequence - sequence >= indexSectors) return 0;
+
+  *address = SLOG_SectorAddress (SLOG_IndexToSector (indexSectors - 1 - (headSequence - sequence)));
+  return 1;
+}
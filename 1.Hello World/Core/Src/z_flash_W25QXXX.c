@@ -5,8 +5,8 @@
  * @version V.1.0.0
  * 
  *********************************************
- * this version of library uses just polling 
- * mode transmission
+ * this version of library uses polling or mixed
+ * polling/DMA mode transmission
  * this version of library uses standard SPI
  *********************************************
  * it needs Z_FLASH_W25QXXX.h configuration
@@ -15,11 +15,96 @@
 
 #include "main.h"
 #include "z_flash_W25QXXX.h"
+#include "string.h"
 
-#define SPI_IS_BUSY 	(HAL_GPIO_ReadPin(FLASH_CS_GPIO_Port, FLASH_CS_Pin)==GPIO_PIN_RESET)
+#define SPI_IS_BUSY 	(Flash_PortIsSelected())
 
 extern SPI_HandleTypeDef FLASH_SPI_PORT;
 
+static uint32_t flashSize = EXT_FLASH_SIZE;	// updated by Flash_Init() with the detected chip size
+
+static uint8_t poweredDown = 0;				// chip is in powerDown, next Flash_Select() releases it
+static uint32_t lastAccessTick = 0;			// HAL tick of the last command, for the idle powerDown
+static uint32_t poweredSince = 0;			// HAL tick of the last release from powerDown
+static FlashPowerStats powerStats = {0};
+
+#ifdef EXT_FLASH_SPI_DMA_MODE
+static volatile uint8_t dmaBusy = 0;			// a DMA transfer is running on the Flash SPI port
+static volatile uint8_t unselectPending = 0;	// chip is unselected by the callback, when the DMA transfer ends
+static uint8_t* dmaRxData;						// next chunk of a DMA receive longer than 64kB
+static volatile uint32_t dmaRxLeft = 0;			// bytes of the DMA receive not started yet
+#endif //EXT_FLASH_SPI_DMA_MODE
+
+typedef enum {
+	FLASH_JOB_IDLE = 0,		// no erase running on the chip
+	FLASH_JOB_RUNNING,		// first queued job sent, chip is BUSY
+	FLASH_JOB_SUSPENDED		// running erase suspended by a read
+} FlashJobState;
+
+typedef struct {
+	uint8_t command;		// erase command to send
+	uint32_t addr;			// erase address, unused by chip erase
+} FlashJob;
+
+static FlashJob jobQueue[EXT_FLASH_JOB_QUEUE_SIZE];	// ring of erases, jobQueue[jobHead] is the running one
+static uint8_t jobHead = 0;
+static uint8_t jobCount = 0;
+static FlashJobState jobState = FLASH_JOB_IDLE;
+static uint32_t jobResumeTick;	// HAL tick of the last resume, a new suspend needs tSUS after it
+
+#if EXT_FLASH_CACHE_SETS
+#define FLASH_CACHE_EMPTY	0xFFFFFFFF
+
+typedef struct {
+	uint32_t page;			// addr / EXT_FLASH_PAGE_SIZE, FLASH_CACHE_EMPTY if unused
+	uint32_t lastUse;		// cacheClock of the last access, for the LRU replacement
+	uint8_t data[EXT_FLASH_PAGE_SIZE];
+} FlashCacheLine;
+
+static FlashCacheLine cache[EXT_FLASH_CACHE_SETS][EXT_FLASH_CACHE_WAYS];
+static uint8_t cacheReady = 0;	// lines are marked empty on first use
+static uint32_t cacheClock = 0;
+static uint32_t cacheHits = 0;
+static uint32_t cacheMisses = 0;
+#endif //EXT_FLASH_CACHE_SETS
+
+
+
+
+/******************************************
+ * @brief	port functions: the only access to the MCU hardware
+ * 			in polling mode. They are weak, so a host build
+ * 			can replace them with a W25Q simulator
+ * 			(EXT_FLASH_SPI_POLLING_MODE must be set, DMA mode
+ * 			uses HAL SPI and its callbacks directly)
+ ******************************************/
+__weak void Flash_PortSetSelected(uint8_t selected) {
+	HAL_GPIO_WritePin(FLASH_CS_GPIO_Port, FLASH_CS_Pin, (selected ? GPIO_PIN_RESET : GPIO_PIN_SET));
+}
+
+__weak uint8_t Flash_PortIsSelected(void) {
+	return (HAL_GPIO_ReadPin(FLASH_CS_GPIO_Port, FLASH_CS_Pin)==GPIO_PIN_RESET);
+}
+
+__weak void Flash_PortTransmit(uint8_t* data, uint16_t dataSize) {
+	HAL_SPI_Transmit(&FLASH_SPI_PORT , data, dataSize, HAL_MAX_DELAY);
+}
+
+__weak void Flash_PortReceive(uint8_t* data, uint16_t dataSize) {
+	HAL_SPI_Receive (&FLASH_SPI_PORT , data, dataSize, HAL_MAX_DELAY);
+}
+
+// busy waits for a few microseconds, HAL_Delay() can't wait less than 1 ms
+__weak void Flash_PortDelayUs(uint32_t us) {
+uint32_t start;
+uint32_t cycles = us * (SystemCoreClock / 1000000);
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	start = DWT->CYCCNT;
+	while ((DWT->CYCCNT - start) < cycles) {}
+}
+
+
 
 
 
@@ -34,7 +119,10 @@ extern SPI_HandleTypeDef FLASH_SPI_PORT;
  ******************************************/
 void Flash_Select(void) {
 		while (SPI_IS_BUSY) {}
-		HAL_GPIO_WritePin(FLASH_CS_GPIO_Port, FLASH_CS_Pin, GPIO_PIN_RESET);
+		if (poweredDown)
+			Flash_PowerUp();
+		lastAccessTick = HAL_GetTick();
+		Flash_PortSetSelected(1);
 }
 
 
@@ -47,15 +135,89 @@ void Flash_Select(void) {
 void Flash_UnSelect(void) {
 	// CS pin must be low (selected flash) until previous transmission is completed
 #ifdef	EXT_FLASH_SPI_POLLING_MODE
-	HAL_GPIO_WritePin(FLASH_CS_GPIO_Port, FLASH_CS_Pin, GPIO_PIN_SET);	//unselect
+	Flash_PortSetSelected(0);	//unselect
+#else
+	// if a DMA transfer is still running, the complete callback unselects the chip
+	__disable_irq();
+	if (dmaBusy)
+		unselectPending = 1;
+	else
+		Flash_PortSetSelected(0);	//unselect
+	__enable_irq();
 #endif  // FLASH_SPI_POLLING_MODE
 }
 
 
 
 
+/******************************************
+ * @brief	waits for the end of a running DMA transfer
+ * 			on Flash SPI port, if any.
+ * 			Any new transfer must wait before engaging the port
+ ******************************************/
+void Flash_WaitForDMA(void) {
+#ifdef	EXT_FLASH_SPI_DMA_MODE
+	while (dmaBusy) {}
+#endif  // EXT_FLASH_SPI_DMA_MODE
+}
+
+
+
+
 void Flash_Receive(uint8_t* data, uint16_t dataSize){
-	HAL_SPI_Receive (&FLASH_SPI_PORT , data, dataSize, HAL_MAX_DELAY);
+	Flash_WaitForDMA();
+	Flash_PortReceive(data, dataSize);
+}
+
+
+
+
+#ifdef EXT_FLASH_SPI_DMA_MODE
+/**************************
+ * @BRIEF	starts next chunk (up to 64kB) of a DMA receive
+ * 			called by Flash_ReceiveDMA() and by the receive complete callback
+ **************************/
+static void Flash_StartReceiveChunkDMA(){
+uint16_t data_to_transfer;
+uint8_t* data;
+
+	data_to_transfer = ((dmaRxLeft>0xFFFF) ? 0xFFFF : (uint16_t)dmaRxLeft);
+	data = dmaRxData;
+	dmaRxData += data_to_transfer;
+	dmaRxLeft -= data_to_transfer;
+	HAL_SPI_Receive_DMA(&FLASH_SPI_PORT, data, data_to_transfer);
+}
+#endif //EXT_FLASH_SPI_DMA_MODE
+
+
+
+
+/**************************
+ * @BRIEF	engages SPI port receiving data from Flash in DMA mode
+ * 			function returns immediately: data is valid after
+ * 			Flash_WaitForDMA() or, if Flash_UnSelect() was called,
+ * 			after CS pin goes high.
+ * 			In polling mode this is a plain receive.
+ * @PARAM	data		buffer to fill with read data
+ * 			dataSize	number of bytes to read
+ **************************/
+void Flash_ReceiveDMA(uint8_t* data, uint32_t dataSize){
+	Flash_WaitForDMA();
+#ifdef EXT_FLASH_SPI_DMA_MODE
+	if (dataSize>=EXT_FLASH_DMA_CUTOFF) {
+		dmaRxData = data;
+		dmaRxLeft = dataSize;
+		dmaBusy = 1;
+		Flash_StartReceiveChunkDMA();
+		return;
+	}
+#endif //EXT_FLASH_SPI_DMA_MODE
+	while (dataSize) {
+		uint16_t data_to_transfer = ((dataSize>0xFFFF) ? 0xFFFF : (uint16_t)dataSize);
+		Flash_Receive(data, data_to_transfer);
+		data+=data_to_transfer;
+		dataSize-=data_to_transfer;
+	}
 }
 
 
@@ -67,7 +229,7 @@ void Flash_Receive(uint8_t* data, uint16_t dataSize){
  * 			dataSize	number of bytes in "data" to be sent
  *********************************************************************/
 void Flash_Polling_Transmit(uint8_t* data, uint16_t dataSize){
-	HAL_SPI_Transmit(&FLASH_SPI_PORT , data, dataSize, HAL_MAX_DELAY);
+	Flash_PortTransmit(data, dataSize);
 }
 
 
@@ -82,13 +244,16 @@ void Flash_Polling_Transmit(uint8_t* data, uint16_t dataSize){
  * 			dataSize	number of bytes in "data" to be sent
  **************************/
 void Flash_Transmit(uint8_t* data, uint16_t dataSize){
+	Flash_WaitForDMA();
 #ifndef	EXT_FLASH_SPI_POLLING_MODE
 	if (dataSize<EXT_FLASH_DMA_CUTOFF) {
 #endif //FLASH_SPI_POLLING_MODE
-		HAL_SPI_Transmit(&FLASH_SPI_PORT , data, dataSize, HAL_MAX_DELAY);
+		Flash_PortTransmit(data, dataSize);
 #ifndef	EXT_FLASH_SPI_POLLING_MODE
 	} else {
-		HAL_SPI_Transmit_DMA(&EXT_FLASH_SPI_PORT , data, dataSize);
+		// "data" must stay valid until the transfer ends: callers wait for CS going high
+		dmaBusy = 1;
+		HAL_SPI_Transmit_DMA(&FLASH_SPI_PORT , data, dataSize);
 	}
 #endif  //FLASH_SPI_POLLING_MODE
 }
@@ -118,19 +283,341 @@ uint8_t buffer[1];
 
 
 /**************************
- * @BRIEF	reads from Flash Eeprom
- * 			using "communication mode" selected by
- * 			command doesn't check for the BUSY flag in SR1
- * 			that must be done before calling this function
- * 			current version of library doesn't need it
+ * @BRIEF	sends powerDown command, no check for running jobs
+ * 			updating the time spent powered
+ **************************/
+static void Flash_EnterPowerDown(){
+uint8_t buffer[1];
+	if (poweredDown)
+		return;
+	buffer[0] = W25_POWERDOWN;
+	Flash_Select();
+	Flash_Transmit(buffer, 1);
+	Flash_UnSelect();
+	powerStats.poweredTime += HAL_GetTick() - poweredSince;
+	poweredDown = 1;
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	reads SR1 register once
+ **************************/
+static uint8_t Flash_ReadSR1(){
+uint8_t buffer[1];
+	Flash_Select();
+	buffer[0] = W25_R_SR1;
+	Flash_Transmit(buffer, 1);
+	Flash_Receive(buffer, 1);
+	Flash_UnSelect();
+	return buffer[0];
+}
+
+
+
+
+
+#if EXT_FLASH_CACHE_SETS
+/**************************
+ * @BRIEF	drops cached pages overlapping a written or erased area
+ * @PARAM	addr		first address of the area
+ * 			size		size of the area in bytes
+ **************************/
+static void Flash_CacheInvalidate(uint32_t addr, uint32_t size){
+uint32_t first = addr / EXT_FLASH_PAGE_SIZE;
+uint32_t last = (addr + size - 1) / EXT_FLASH_PAGE_SIZE;
+	if (!cacheReady)
+		return;
+	for (uint8_t set=0; set<EXT_FLASH_CACHE_SETS; set++)
+		for (uint8_t way=0; way<EXT_FLASH_CACHE_WAYS; way++)
+			if ((cache[set][way].page >= first) && (cache[set][way].page <= last))
+				cache[set][way].page = FLASH_CACHE_EMPTY;
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	returns the cache line holding a page, reading it
+ * 			from the chip (replacing the least recently used
+ * 			page of the set) if it isn't cached.
+ * 			Set index mixes higher page bits: sector headers
+ * 			all are at page 0 of a sector, they would share one set
+ **************************/
+static FlashCacheLine* Flash_CacheGetPage(uint32_t page){
+FlashCacheLine* set;
+FlashCacheLine* line;
+	if (!cacheReady) {
+		for (uint8_t i=0; i<EXT_FLASH_CACHE_SETS; i++)
+			for (uint8_t way=0; way<EXT_FLASH_CACHE_WAYS; way++)
+				cache[i][way].page = FLASH_CACHE_EMPTY;
+		cacheReady = 1;
+	}
+	set = cache[(page ^ (page >> 4) ^ (page >> 8)) % EXT_FLASH_CACHE_SETS];
+	cacheClock++;
+	line = &set[0];
+	for (uint8_t way=0; way<EXT_FLASH_CACHE_WAYS; way++) {
+		if (set[way].page == page) {
+			cacheHits++;
+			set[way].lastUse = cacheClock;
+			return &set[way];
+		}
+		if (line->page == FLASH_CACHE_EMPTY)
+			continue;	// an empty line is the best victim
+		if ((set[way].page == FLASH_CACHE_EMPTY) || (set[way].lastUse < line->lastUse))
+			line = &set[way];
+	}
+	cacheMisses++;
+	Flash_StartRead(page * EXT_FLASH_PAGE_SIZE);
+	Flash_ContinueRead(line->data, EXT_FLASH_PAGE_SIZE);
+	Flash_EndRead();
+	line->page = page;
+	line->lastUse = cacheClock;
+	return line;
+}
+#endif //EXT_FLASH_CACHE_SETS
+
+
+
+
+
+/**************************
+ * @BRIEF	cache counters since MCU reset
+ * @PARAM	hits		reads served from RAM (one per page)
+ * 			misses		pages read from the chip
+ **************************/
+void Flash_GetCacheStats(uint32_t* hits, uint32_t* misses){
+#if EXT_FLASH_CACHE_SETS
+	*hits = cacheHits;
+	*misses = cacheMisses;
+#else
+	*hits = 0;
+	*misses = 0;
+#endif //EXT_FLASH_CACHE_SETS
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	size of the area cleared by an erase command
+ **************************/
+static uint32_t Flash_EraseSize(uint8_t command){
+	switch (command) {
+	case W25_S_ERASE4K:
+		return EXT_FLASH_SECTOR_SIZE;
+	case W25_B_ERASE32K:
+		return EXT_FLASH_BLOCK_SIZE / 2;
+	case W25_B_ERASE64K:
+		return EXT_FLASH_BLOCK_SIZE;
+	default:
+		return flashSize;	//chip erase
+	}
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	sends "write enable" and the erase command of a job
+ * 			not waiting for the erase complete
+ **************************/
+static void Flash_StartJob(FlashJob* job){
+uint8_t buffer[4];
+	Flash_Select();
+	buffer[0] = W25_W_ENABLE;
+	Flash_Transmit(buffer, 1);
+	Flash_UnSelect();
+
+#if EXT_FLASH_CACHE_SETS
+	Flash_CacheInvalidate(job->addr, Flash_EraseSize(job->command));
+#endif //EXT_FLASH_CACHE_SETS
+	buffer[0] = job->command;
+	buffer[1] = (job->addr >> 16) & 0xFF;
+	buffer[2] = (job->addr >> 8) & 0xFF;
+	buffer[3] = job->addr & 0xFF;
+	Flash_Select();
+	Flash_Transmit(buffer, (job->command == W25_CH_ERASE ? 1 : 4));
+	Flash_UnSelect();
+	jobState = FLASH_JOB_RUNNING;
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	makes the chip readable while an erase is running:
+ * 			sector and block erases are suspended (tSUS, 20us),
+ * 			a chip erase can't be suspended so it is waited for.
+ * 			The erase stays suspended until next Flash_Process() call,
+ * 			so a burst of reads (a chart, a line of text) pays it once.
+ * 			Data of the area being erased is not valid while suspended
+ **************************/
+static void Flash_SuspendJob(){
+uint8_t buffer[1];
+	if (jobState != FLASH_JOB_RUNNING)
+		return;
+	if (jobQueue[jobHead].command == W25_CH_ERASE) {
+		Flash_WaitForWritingComplete();
+		return;		// Flash_Process() will find it ended
+	}
+	// datasheet requires tSUS after a resume before suspending again
+	while (HAL_GetTick() == jobResumeTick) {}
+	buffer[0] = W25_EP_SUS;
+	Flash_Select();
+	Flash_Transmit(buffer, 1);
+	Flash_UnSelect();
+	Flash_WaitForWritingComplete();	// BUSY goes to 0 when suspended, or if erase just ended
+	jobState = FLASH_JOB_SUSPENDED;
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	resumes an erase suspended by a read
+ * 			(resuming an erase already ended is ignored by the chip)
+ **************************/
+static void Flash_ResumeJob(){
+uint8_t buffer[1];
+	buffer[0] = W25_EP_RES;
+	Flash_Select();
+	Flash_Transmit(buffer, 1);
+	Flash_UnSelect();
+	jobResumeTick = HAL_GetTick();
+	jobState = FLASH_JOB_RUNNING;
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	adds an erase to the job queue and starts it if the chip is free
+ * @RETURN	0 if the queue is full
+ **************************/
+static uint8_t Flash_QueueJob(uint8_t command, uint32_t addr){
+FlashJob* job;
+	if (jobCount == EXT_FLASH_JOB_QUEUE_SIZE)
+		return 0;
+	job = &jobQueue[(jobHead + jobCount) % EXT_FLASH_JOB_QUEUE_SIZE];
+	job->command = command;
+	job->addr = addr;
+	jobCount++;
+	Flash_Process();
+	return 1;
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	non blocking version of Flash_SErase4k()
+ * 			erase is run by Flash_Process(): the sector can't be
+ * 			written until Flash_Process() returns 0.
+ * 			Reads are allowed, see Flash_SuspendJob()
+ * @PARAM	addr	starting erase address
+ * 					(it must be a 4k sector boundary)
+ * @RETURN	0 if the queue is full, nothing done
+ **************************/
+uint8_t Flash_QueueSErase4k(uint32_t addr){
+	return Flash_QueueJob(W25_S_ERASE4K, addr);
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	non blocking version of Flash_ChipErase()
+ * 			reads issued while it runs wait until it ends
+ * @RETURN	0 if the queue is full, nothing done
+ **************************/
+uint8_t Flash_QueueChipErase(){
+	return Flash_QueueJob(W25_CH_ERASE, 0);
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	runs the job queue, to be called from the main loop:
+ * 			resumes a suspended erase, checks if the running
+ * 			one ended and starts the next.
+ * 			With no jobs left, chip goes to powerDown after
+ * 			EXT_FLASH_IDLE_POWERDOWN ms without commands.
+ * 			It only reads SR1 once, never waits for the chip
+ * @RETURN	0 if there are no jobs left
+ **************************/
+uint8_t Flash_Process(){
+	if (jobState == FLASH_JOB_SUSPENDED) {
+		Flash_ResumeJob();
+		return 1;
+	}
+	if (jobState == FLASH_JOB_RUNNING) {
+		if (Flash_ReadSR1() & SR1_BIT_BUSY)
+			return 1;
+#if EXT_FLASH_CACHE_SETS
+		// pages read while the erase was suspended are not valid
+		Flash_CacheInvalidate(jobQueue[jobHead].addr, Flash_EraseSize(jobQueue[jobHead].command));
+#endif //EXT_FLASH_CACHE_SETS
+		jobHead = (jobHead + 1) % EXT_FLASH_JOB_QUEUE_SIZE;
+		jobCount--;
+		jobState = FLASH_JOB_IDLE;
+	}
+	if (jobCount == 0) {
+#if EXT_FLASH_IDLE_POWERDOWN
+		if (!SPI_IS_BUSY && ((HAL_GetTick() - lastAccessTick) >= EXT_FLASH_IDLE_POWERDOWN))
+			Flash_EnterPowerDown();
+#endif //EXT_FLASH_IDLE_POWERDOWN
+		return 0;
+	}
+	Flash_StartJob(&jobQueue[jobHead]);
+	return 1;
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	waits until all queued jobs ended
+ * 			needed before any write or erase, and before
+ * 			going to powerDown or to the MCU standby
+ **************************/
+void Flash_WaitForJobs(){
+	while (Flash_Process()) {}
+}
+
+
+
+
+
+/**************************
+ * @BRIEF	starts a read session on Flash Eeprom
+ * 			sends read command and address, leaving the chip selected:
+ * 			data is then clocked out by Flash_ContinueRead()
+ * 			as a single sequential stream, so a long area can be read
+ * 			in chunks paying command overhead just once.
+ * 			Session must be closed by Flash_EndRead(), no other
+ * 			Flash command can be sent in between.
+ * 			command doesn't check for the BUSY flag in SR1,
+ * 			but it suspends a queued erase running on the chip
  * @PARAM	addr		EEPROM address to start reading
- *  		data		buffer to fill with read data
- * 			dataSize	number of bytes to read
  **************************/
-void Flash_Read(uint32_t addr, uint8_t* data, uint32_t dataSize){
-uint16_t data_to_transfer;
+void Flash_StartRead(uint32_t addr){
 uint8_t buffer[5];
 
+	Flash_SuspendJob();
 	buffer[0] = FLASH_READ_COMMAND;
 	buffer[1] = (addr >> 16) & 0xFF;
 	buffer[2] = (addr >> 8) & 0xFF;
@@ -138,20 +625,86 @@ uint8_t buffer[5];
 	buffer[4] = W25_DUMMY;
 	Flash_Select();
 	Flash_Transmit(buffer, (FLASH_READ_COMMAND == W25_READ ? 4 : 5));  // "normal/slow" read command doesn't need sending dummy byte
+}
 
-	// dataSize is 32 bit, spi_receive handles 16bit transfers, so I have to loop...
-	while (dataSize) {
-		data_to_transfer = ((dataSize>0xFFFF) ? 0xFFFF : (uint16_t)dataSize);
-		Flash_Receive(data, data_to_transfer);
-		data+=data_to_transfer;
-		dataSize-=data_to_transfer;
-	}
+
+
+
+/**************************
+ * @BRIEF	reads next bytes of a session opened by Flash_StartRead()
+ * @PARAM	data		buffer to fill with read data
+ * 			dataSize	number of bytes to read
+ **************************/
+void Flash_ContinueRead(uint8_t* data, uint32_t dataSize){
+	// dataSize is 32 bit, spi_receive handles 16bit transfers: Flash_ReceiveDMA() splits it
+	Flash_ReceiveDMA(data, dataSize);
+	Flash_WaitForDMA();
+}
+
+
+
+
+/**************************
+ * @BRIEF	non blocking version of Flash_ContinueRead():
+ * 			returns while data is still being received.
+ * 			"data" is valid after Flash_WaitForDMA(), meanwhile
+ * 			the CPU (or another DMA stream) can use the previous chunk
+ * @PARAM	data		buffer to fill with read data
+ * 			dataSize	number of bytes to read
+ **************************/
+void Flash_ContinueReadDMA(uint8_t* data, uint32_t dataSize){
+	Flash_ReceiveDMA(data, dataSize);
+}
+
+
+
+
+/**************************
+ * @BRIEF	closes a read session opened by Flash_StartRead()
+ **************************/
+void Flash_EndRead(){
 	Flash_UnSelect();
 }
 
 
 
 
+/**************************
+ * @BRIEF	reads from Flash Eeprom
+ * 			using "communication mode" selected by
+ * 			command doesn't check for the BUSY flag in SR1
+ * 			that must be done before calling this function
+ * 			current version of library doesn't need it
+ * 			Short reads are served by the page cache,
+ * 			kept coherent by writes and erases of this library
+ * @PARAM	addr		EEPROM address to start reading
+ *  		data		buffer to fill with read data
+ * 			dataSize	number of bytes to read
+ **************************/
+void Flash_Read(uint32_t addr, uint8_t* data, uint32_t dataSize){
+#if EXT_FLASH_CACHE_SETS
+	if (dataSize <= EXT_FLASH_CACHE_MAX_READ) {
+		while (dataSize) {
+			uint32_t offset = addr % EXT_FLASH_PAGE_SIZE;
+			uint32_t size = EXT_FLASH_PAGE_SIZE - offset;
+			if (size > dataSize)
+				size = dataSize;
+			memcpy(data, Flash_CacheGetPage(addr / EXT_FLASH_PAGE_SIZE)->data + offset, size);
+			addr += size;
+			data += size;
+			dataSize -= size;
+		}
+		return;
+	}
+#endif //EXT_FLASH_CACHE_SETS
+	Flash_StartRead(addr);
+	Flash_ContinueRead(data, dataSize);
+	Flash_EndRead();
+}
+
+
+
+
 
 
 
@@ -168,6 +721,9 @@ uint8_t buffer[5];
  ***********************************************************************/
 void Flash_SimpleWriteAPage(uint32_t addr, uint8_t* data, uint16_t dataSize){
 uint8_t buffer[4];
+#if EXT_FLASH_CACHE_SETS
+	Flash_CacheInvalidate(addr, dataSize);
+#endif //EXT_FLASH_CACHE_SETS
 	buffer[0] = W25_PAGE_P;
 	buffer[1] = (addr >> 16) & 0xFF;
 	buffer[2] = (addr >> 8) & 0xFF;
@@ -200,6 +756,7 @@ uint32_t inpage_addr;
 
 	if (dataSize==0)
 		return;
+	Flash_WaitForJobs();
 
 	// quota is the data size trasferred until now
 	quota=0;
@@ -247,6 +804,10 @@ uint32_t inpage_addr;
  *********************************/
 void Flash_SErase4k(uint32_t addr){
 uint8_t buffer[4];
+	Flash_WaitForJobs();
+#if EXT_FLASH_CACHE_SETS
+	Flash_CacheInvalidate(addr, EXT_FLASH_SECTOR_SIZE);
+#endif //EXT_FLASH_CACHE_SETS
 	Flash_Select();
 	buffer[0] = W25_W_ENABLE;
 	Flash_Transmit(buffer, 1);
@@ -275,6 +836,10 @@ uint8_t buffer[4];
  *********************************/
 void Flash_BErase32k(uint32_t addr){
 uint8_t buffer[4];
+	Flash_WaitForJobs();
+#if EXT_FLASH_CACHE_SETS
+	Flash_CacheInvalidate(addr, EXT_FLASH_BLOCK_SIZE / 2);
+#endif //EXT_FLASH_CACHE_SETS
 	Flash_Select();
 	buffer[0] = W25_W_ENABLE;
 	Flash_Transmit(buffer, 1);
@@ -304,6 +869,10 @@ uint8_t buffer[4];
  *********************************/
 void Flash_BErase64k(uint32_t addr){
 uint8_t buffer[4];
+	Flash_WaitForJobs();
+#if EXT_FLASH_CACHE_SETS
+	Flash_CacheInvalidate(addr, EXT_FLASH_BLOCK_SIZE);
+#endif //EXT_FLASH_CACHE_SETS
 	Flash_Select();
 	buffer[0] = W25_W_ENABLE;
 	Flash_Transmit(buffer, 1);
@@ -330,6 +899,10 @@ uint8_t buffer[4];
  *********************************/
 void Flash_ChipErase(){
 uint8_t buffer[4];
+	Flash_WaitForJobs();
+#if EXT_FLASH_CACHE_SETS
+	Flash_CacheInvalidate(0, flashSize);
+#endif //EXT_FLASH_CACHE_SETS
 	Flash_Select();
 	buffer[0] = W25_W_ENABLE;
 	Flash_Transmit(buffer, 1);
@@ -350,14 +923,13 @@ uint8_t buffer[4];
  * @BRIEF	Initiates a powerdown
  * 			after a powerDown only accepted a porweUp command
  * 			opwerDown operation is 3us long
+ * 			waiting for queued jobs before: call it before
+ * 			MCU standby, Flash_Process() does it when idle.
+ * 			Next command releases the chip by itself
  *********************************/
 void Flash_PowerDown(){
-uint8_t buffer[4];
-
-	buffer[0] = W25_POWERDOWN;
-	Flash_Select();
-	Flash_Transmit(buffer, 1);
-	Flash_UnSelect();
+	Flash_WaitForJobs();
+	Flash_EnterPowerDown();
 }
 
 
@@ -368,15 +940,47 @@ uint8_t buffer[4];
 
 /**********************************
  * @BRIEF	Release from powerdown (3 us to restart) or read device ID
+ * 			called by Flash_Select() when the chip is in powerDown
  *********************************/
 void Flash_PowerUp(){
 uint8_t buffer[4];
+uint8_t wasPoweredDown = poweredDown;
 
+	poweredDown = 0;	// or Flash_Select() would call this function again
 	buffer[0] = W25_POWERUP_ID;
 	Flash_Select();
 	Flash_Transmit(buffer, 1);
 	Flash_UnSelect();
-	HAL_Delay(1);
+	Flash_PortDelayUs(W25_T_RES1_US);
+	if (wasPoweredDown)
+		powerStats.wakeUps++;
+	poweredSince = HAL_GetTick();
+}
+
+
+
+
+
+/**********************************
+ * @BRIEF	copies powerDown counters, including the time
+ * 			of the running powered period
+ *********************************/
+void Flash_GetPowerStats(FlashPowerStats* stats){
+	*stats = powerStats;
+	if (!poweredDown)
+		stats->poweredTime += HAL_GetTick() - poweredSince;
+}
+
+
+
+
+
+/**********************************
+ * @BRIEF	sets powerDown counters, RAM is lost in MCU standby
+ * 			so they can be kept by the application
+ *********************************/
+void Flash_SetPowerStats(FlashPowerStats* stats){
+	powerStats = *stats;
 }
 
 
@@ -502,22 +1106,57 @@ uint8_t test=1;
 /******************************************************************
  * @BRIEF	reading manufacutrer and device ID
  * 			checking if connected device is a Winbond Flash
+ * 			and detecting its size from the JEDEC capacity code
  ******************************************************************/
 uint8_t Flash_Init(){
 uint32_t JedecID;
+uint8_t capacity;
 	//HAL_Delay(6);	// supposing init is called on system startup: 5 ms (tPUW) required after power-up to be fully available
+	// the reset below ends any running erase, so nothing of the previous session is valid.
+	// RAM is clean after an MCU reset anyway, a host test restarting after a power cut is not
+#ifdef EXT_FLASH_SPI_DMA_MODE
+	dmaBusy = 0;
+	unselectPending = 0;
+	dmaRxLeft = 0;
+#endif //EXT_FLASH_SPI_DMA_MODE
+#if EXT_FLASH_CACHE_SETS
+	cacheReady = 0;
+#endif //EXT_FLASH_CACHE_SETS
+	jobCount = 0;
+	jobState = FLASH_JOB_IDLE;
+	// chip ignores reset in powerDown: it is left there before MCU standby
+	poweredDown = 1;
+	Flash_PowerUp();
 	Flash_Reset();
 	if (!Flash_TestAvailability())
 		return 0;
 	JedecID=Flash_ReadJedecID() ;	//select the memSize byte
 	if (((JedecID >> 16) & 0XFF) != 0xEF)  // if ManufacturerID is not Winbond (0xEF)
 		return 0;
+	capacity = JedecID & 0xFF;
+	// W25Q capacity code is log2 of the size in bytes (0x18 -> 16MB).
+	// Codes out of the 24 bit address range fall back to the configured chip
+	if ((capacity >= 0x11) && (capacity <= 0x18))
+		flashSize = (1UL << capacity);
+	else
+		flashSize = EXT_FLASH_SIZE;
 	return 1;  //return memSize as per table in Flash_ReadJedecID() definition
 }
 
 
 
 
+/******************************************************************
+ * @RETURN	size of the connected chip in bytes, as detected
+ * 			by Flash_Init(). Before init it returns EXT_FLASH_SIZE
+ ******************************************************************/
+uint32_t Flash_GetSize(){
+	return flashSize;
+}
+
+
+
+
 
 void Flash_Reset(){
 uint8_t command;
@@ -529,7 +1168,7 @@ uint8_t command;
 	Flash_Select();
 	Flash_Transmit(&command, 1);
 	Flash_UnSelect();
-	HAL_Delay(1);	// 30us needed by resetting
+	Flash_PortDelayUs(W25_T_RST_US);
 }
 
 
@@ -538,9 +1177,13 @@ uint8_t command;
 
 
 
+/**************************
+ * @BRIEF	waits until the read started by DataReader_StartDMAReadData()
+ * 			is complete: the chip is unselected by the DMA complete callback.
+ * 			In polling mode reads are already complete, so it returns immediately
+ **************************/
 void DataReader_WaitForReceiveDone(){
-// nothing to do, being reading always in polling mode
-	return;
+	while (SPI_IS_BUSY) {}
 }
 
 void DataReader_ReadData(uint32_t address24, uint8_t* buffer, uint32_t length){
@@ -548,10 +1191,67 @@ void DataReader_ReadData(uint32_t address24, uint8_t* buffer, uint32_t length){
 }
 
 
+/**************************
+ * @BRIEF	starts reading from Flash in DMA mode and returns
+ * 			while data is still being transferred, so the CPU can
+ * 			do something else meanwhile.
+ * 			"buffer" must not be used before DataReader_WaitForReceiveDone(),
+ * 			any other Flash command waits for the end of the read.
+ * @PARAM	address24	EEPROM address to start reading
+ *  		buffer		buffer to fill with read data
+ * 			length		number of bytes to read
+ **************************/
 void DataReader_StartDMAReadData(uint32_t address24, uint8_t* buffer, uint32_t length){
-//currently using polling mode even if requested DMA
-	Flash_Read(address24, buffer, length);
+	Flash_StartRead(address24);
+	Flash_ReceiveDMA(buffer, length);
+	Flash_EndRead();
+}
+
+
+
+
+#ifdef EXT_FLASH_SPI_DMA_MODE
+/**************************
+ * @BRIEF	ends a DMA transfer on Flash SPI port:
+ * 			starts the next chunk of a long receive or
+ * 			releases the port, unselecting the chip if requested
+ **************************/
+static void Flash_DMATransferDone(){
+	if (dmaRxLeft) {
+		Flash_StartReceiveChunkDMA();
+		return;
+	}
+	dmaBusy = 0;
+	if (unselectPending) {
+		unselectPending = 0;
+		Flash_PortSetSelected(0);	//unselect
+	}
+}
+
+
+
+
+/**************************
+ * @BRIEF	HAL SPI callbacks, other SPI ports are ignored
+ **************************/
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi){
+	if (hspi->Instance == FLASH_SPI)
+		Flash_DMATransferDone();
+}
+
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi){
+	if (hspi->Instance == FLASH_SPI)
+		Flash_DMATransferDone();
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi){
+	// transfer is lost, but the port must be released anyway
+	if (hspi->Instance == FLASH_SPI) {
+		dmaRxLeft = 0;
+		Flash_DMATransferDone();
+	}
 }
+#endif //EXT_FLASH_SPI_DMA_MODE
 
 
 
@@ -0,0 +1,77 @@
+/*
+ * calendar_test.c
+ *
+ * Host test of the calendar calculations (Core/Src/calendar.c). Every day from
+ * 2000-01-01 to 2099-12-31 is walked one by one, counting the weekday along, and
+ * compared with CAL_DaysFromCivil(), CAL_CivilFromDays(), CAL_WeekDay(),
+ * CAL_DaysInMonth(), CAL_LastSunday() and RTC_ToEpochSeconds().
+ *
+ * Build and run from the project directory:
+ *     cc -O2 -I Tools/host -I Core/Inc -o calendar_test Tools/calendar_test.c \
+ *         Core/Src/calendar.c && ./calendar_test
+ */
+
+#include "calendar.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LAST_YEAR 2099
+
+#define CHECK(condition) \
+  do { if (!(condition)) { printf ("FAILED line %d: %s\n", __LINE__, #condition); exit (1); } } while (0)
+
+/*
+ * Month length by the plain rules, no tables shared with calendar.c
+ */
+static uint8_t NaiveDaysInMonth (uint16_t year, uint8_t month)
+{
+  if (month == 2) return ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0) ? 29 : 28;
+  if (month == 4 || month == 6 || month == 9 || month == 11) return 30;
+  return 31;
+}
+
+int main (void)
+{
+  uint32_t days = 0, checked = 0;
+  CAL_WeekDay_t weekDay = CAL_SATURDAY; // 2000-01-01
+  RTC_TimeTypeDef time = { 23, 59, 58 };
+  RTC_DateTypeDef date;
+
+  for (uint16_t year = CAL_EPOCH_YEAR; year <= LAST_YEAR; year++)
+  {
+    CHECK(CAL_IsLeapYear (year) == (NaiveDaysInMonth (year, 2) == 29));
+
+    for (uint8_t month = 1; month <= 12; month++)
+    {
+      uint8_t lastSunday = 0;
+
+      CHECK(CAL_DaysInMonth (year, month) == NaiveDaysInMonth (year, month));
+      for (uint8_t day = 1; day <= NaiveDaysInMonth (year, month); day++)
+      {
+	uint16_t y;
+	uint8_t m, d;
+
+	CHECK(CAL_DaysFromCivil (year, month, day) == days);
+	CAL_CivilFromDays (days, &y, &m, &d);
+	CHECK(y == year && m == month && d == day);
+	CHECK(CAL_WeekDay (days) == weekDay);
+
+	date.Year = year - CAL_EPOCH_YEAR;
+	date.Month = month;
+	date.Date = day;
+	CHECK(RTC_ToEpochSeconds (&time, &date) == days * CAL_SECONDS_PER_DAY + 86398);
+
+	if (weekDay == CAL_SUNDAY) lastSunday = day;
+	weekDay = (weekDay == CAL_SUNDAY) ? CAL_MONDAY : weekDay + 1;
+	days++;
+	checked++;
+      }
+      CHECK(CAL_LastSunday (year, month) == lastSunday);
+    }
+  }
+
+  CHECK(CAL_DaysInMonth (2000, 0) == 0 && CAL_DaysInMonth (2000, 13) == 0);
+
+  printf ("calendar test passed: %u days from %u to %u\n", checked, CAL_EPOCH_YEAR, LAST_YEAR);
+  return 0;
+}
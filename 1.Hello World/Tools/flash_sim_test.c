@@ -0,0 +1,215 @@
+/*
+ * flash_sim_test.c
+ *
+ * Host test of the flash driver (Core/Src/z_flash_W25QXXX.c) running on the W25Q
+ * simulator of Tools/host: identification, programs and erases with their NOR rules,
+ * queued erases suspended by reads, power down, erase counts kept in the backing file
+ * and power cuts during a program and during an erase.
+ *
+ * Build and run from the project directory:
+ *     cc -O2 -I Tools/host -I Core/Inc -o flash_sim_test Tools/flash_sim_test.c \
+ *         Tools/host/flash_sim.c Core/Src/z_flash_W25QXXX.c && ./flash_sim_test
+ */
+
+#include "main.h"
+#include "flash_sim.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SIM_FILE "flash_sim_test.bin"
+#define CUT_RUNS 200
+
+#define CHECK(condition) \
+  do { if (!(condition)) { printf ("FAILED line %d: %s\n", __LINE__, #condition); exit (1); } } while (0)
+
+static jmp_buf powerCut;
+static uint8_t pattern[FLASH_SIM_SECTOR_SIZE], readBack[FLASH_SIM_SECTOR_SIZE];
+
+static void PowerCutHandler (void)
+{
+  longjmp (powerCut, 1);
+}
+
+static void FillPattern (uint8_t* data, uint32_t size, uint32_t seed)
+{
+  for (uint32_t i = 0; i < size; i++)
+    data[i] = (uint8_t) (i * 7 + seed * 13 + (i >> 8));
+}
+
+/*
+ * Count the bytes of an area which are neither the old nor the new content.
+ * A program only clears bits, so a byte is never allowed to lose a bit of the new content.
+ */
+static uint32_t CountTornBytes (const uint8_t* area, const uint8_t* oldData, const uint8_t* newData, uint32_t size)
+{
+  uint32_t torn = 0;
+
+  for (uint32_t i = 0; i < size; i++)
+  {
+    CHECK((area[i] & newData[i]) == newData[i] || (area[i] & oldData[i]) == oldData[i]);
+    if (area[i] != oldData[i] && area[i] != newData[i]) torn++;
+  }
+  return torn;
+}
+
+static void TestIdentification (void)
+{
+  CHECK(Flash_Init ());
+  CHECK(Flash_ReadJedecID () == 0xEF4018);
+  CHECK(Flash_GetSize () == FLASH_SIM_SIZE);
+  CHECK(Flash_ReadDevID () == 0x17);
+  printf ("identification OK\n");
+}
+
+static void TestProgramAndErase (void)
+{
+  uint32_t address = 0x10000;
+  uint64_t start;
+  uint8_t data[4];
+
+  // A write across page boundaries, read back long and short (through the page cache)
+  Flash_SErase4k (address);
+  FillPattern (pattern, 1000, 1);
+  Flash_Write (address + 200, pattern, 1000);
+  Flash_Read (address + 200, readBack, 1000);
+  CHECK(memcmp (pattern, readBack, 1000) == 0);
+  for (uint32_t i = 0; i < 1000; i += 37)
+  {
+    Flash_Read (address + 200 + i, data, 1);
+    CHECK(data[0] == pattern[i]);
+  }
+
+  // A program only clears bits
+  data[0] = 0xF0;
+  Flash_Write (address + 3000, data, 1);
+  data[0] = 0x3C;
+  Flash_Write (address + 3000, data, 1);
+  Flash_Read (address + 3000, data, 1);
+  CHECK(data[0] == 0x30);
+
+  // An erase takes its datasheet time and is counted
+  start = FlashSim_GetTimeNs ();
+  Flash_SErase4k (address);
+  CHECK(FlashSim_GetTimeNs () - start >= FLASH_SIM_ERASE4K_US * 1000ULL);
+  CHECK(FlashSim_GetEraseCount (address / FLASH_SIM_SECTOR_SIZE) == 2);
+  Flash_Read (address, readBack, FLASH_SIM_SECTOR_SIZE);
+  for (uint32_t i = 0; i < FLASH_SIM_SECTOR_SIZE; i++)
+    CHECK(readBack[i] == 0xFF);
+
+  Flash_BErase32k (0x20000);
+  Flash_BErase64k (0x30000);
+  CHECK(FlashSim_GetEraseCount (0x20000 / FLASH_SIM_SECTOR_SIZE + 7) == 1);
+  CHECK(FlashSim_GetEraseCount (0x30000 / FLASH_SIM_SECTOR_SIZE + 15) == 1);
+  printf ("program and erase OK\n");
+}
+
+static void TestQueuedErase (void)
+{
+  uint32_t address = 0x40000;
+
+  FillPattern (pattern, FLASH_SIM_SECTOR_SIZE, 2);
+  Flash_Write (address, pattern, FLASH_SIM_SECTOR_SIZE);
+  Flash_Write (address + FLASH_SIM_SECTOR_SIZE, pattern, FLASH_SIM_SECTOR_SIZE);
+
+  // A read during a queued erase suspends it, the other sector stays readable
+  CHECK(Flash_QueueSErase4k (address));
+  Flash_Read (address + FLASH_SIM_SECTOR_SIZE, readBack, FLASH_SIM_SECTOR_SIZE);
+  CHECK(memcmp (pattern, readBack, FLASH_SIM_SECTOR_SIZE) == 0);
+  Flash_WaitForJobs ();
+  Flash_Read (address, readBack, FLASH_SIM_SECTOR_SIZE);
+  for (uint32_t i = 0; i < FLASH_SIM_SECTOR_SIZE; i++)
+    CHECK(readBack[i] == 0xFF);
+
+  // The next command releases the chip from power down
+  Flash_PowerDown ();
+  Flash_Read (address + FLASH_SIM_SECTOR_SIZE, readBack, 16);
+  CHECK(memcmp (pattern, readBack, 16) == 0);
+  printf ("queued erase and power down OK\n");
+}
+
+static void TestPowerCuts (void)
+{
+  static uint8_t erased[FLASH_SIM_SECTOR_SIZE], before[FLASH_SIM_SECTOR_SIZE];
+  // Kept out of registers, longjmp() returns here
+  static uint32_t run, cutsInProgram, cutsInErase, partial;
+  uint32_t address = 0x50000;
+
+  memset (erased, 0xFF, sizeof(erased));
+  srand (1);
+  for (run = 0; run < CUT_RUNS; run++)
+  {
+    // Cut at any byte of a program of a full sector, or of the erase of a programmed one
+    uint8_t isErase = run & 1;
+
+    CHECK(Flash_Init ());
+    Flash_SErase4k (address);
+    FillPattern (pattern, FLASH_SIM_SECTOR_SIZE, run);
+    if (isErase) Flash_Write (address, pattern, FLASH_SIM_SECTOR_SIZE);
+    Flash_Read (address, before, FLASH_SIM_SECTOR_SIZE);
+
+    if (setjmp (powerCut) == 0)
+    {
+      // Bytes of the bus of the whole operation, most of them are polls of SR1
+      FlashSim_SetPowerCut (rand () % (isErase ? 120000 : 18000), PowerCutHandler);
+      if (isErase)
+	Flash_SErase4k (address);
+      else
+	Flash_Write (address, pattern, FLASH_SIM_SECTOR_SIZE);
+      FlashSim_SetPowerCut (-1, NULL);
+      continue;
+    }
+
+    // Restarted after the cut
+    CHECK(Flash_Init ());
+    Flash_Read (address, readBack, FLASH_SIM_SECTOR_SIZE);
+    if (memcmp (readBack, before, FLASH_SIM_SECTOR_SIZE) != 0
+	&& memcmp (readBack, isErase ? erased : pattern, FLASH_SIM_SECTOR_SIZE) != 0) partial++;
+    if (isErase)
+    {
+      CHECK(CountTornBytes (readBack, before, erased, FLASH_SIM_SECTOR_SIZE) <= 1);
+      cutsInErase++;
+    }
+    else
+    {
+      CHECK(CountTornBytes (readBack, before, pattern, FLASH_SIM_SECTOR_SIZE) <= 1);
+      cutsInProgram++;
+    }
+  }
+  CHECK(cutsInProgram > 0 && cutsInErase > 0 && partial > 0);
+  printf ("power cuts OK: %u in programs, %u in erases, %u left the sector half written\n", cutsInProgram,
+	  cutsInErase, partial);
+}
+
+int main (void)
+{
+  FlashSim_Stats_t stats;
+  uint32_t eraseCount;
+
+  unlink (SIM_FILE);
+  CHECK(FlashSim_Open (SIM_FILE));
+
+  TestIdentification ();
+  TestProgramAndErase ();
+  TestQueuedErase ();
+
+  // The driver never misuses the chip
+  FlashSim_GetStats (&stats);
+  CHECK(stats.busyCommands == 0 && stats.noWriteEnable == 0 && stats.pageWraps == 0);
+  CHECK(stats.poweredDownCommands == 0);
+
+  TestPowerCuts ();
+
+  // Erase counts are kept in the backing file
+  eraseCount = FlashSim_GetEraseCount (0x50000 / FLASH_SIM_SECTOR_SIZE);
+  FlashSim_Close ();
+  CHECK(FlashSim_Open (SIM_FILE));
+  CHECK(FlashSim_GetEraseCount (0x50000 / FLASH_SIM_SECTOR_SIZE) == eraseCount);
+  FlashSim_Close ();
+  unlink (SIM_FILE);
+
+  printf ("flash simulator test passed, %u erases of the power cut sector\n", eraseCount);
+  return 0;
+}
@@ -0,0 +1,268 @@
+/*
+ * ftl_test.c
+ *
+ * Host test of the flash translation layer (Core/Src/ftl.c) on the W25Q simulator
+ * of Tools/host. A hot set of logical sectors is rewritten over and over next to cold
+ * ones written once, so the static levelling moves cold data. The power is cut at
+ * random bytes of FTL_BeginWrite()/FTL_WriteData() and of FTL_EndWrite(), which runs
+ * the static relocation. After every cut the flash driver and the FTL are started again
+ * and the test checks that:
+ *   - every logical sector holds its last completed write, or the interrupted one,
+ *   - the map built by the fast mount is the one a full scan of the headers gives,
+ *     with no physical sector used twice,
+ *   - the erase counts rebuilt by the mount are the ones of the headers, and every header
+ *     keeps the real erase count of its sector. Only the sector interrupted by a cut may
+ *     lose its count, the FTL then starts it again from an estimate.
+ *
+ * The static levelling threshold is lowered, so relocations start after a few
+ * hundred writes. Build and run from the project directory:
+ *     cc -O2 -DFTL_STATIC_THRESHOLD=8 -I Tools/host -I Core/Inc -o ftl_test Tools/ftl_test.c \
+ *         Tools/host/flash_sim.c Core/Src/z_flash_W25QXXX.c Core/Src/ftl.c && ./ftl_test
+ */
+
+#include "main.h"
+#include "ftl.h"
+#include "flash_sim.h"
+#include <setjmp.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SIM_FILE "ftl_test.bin"
+#define WRITES 4000
+#define LOGICAL_USED 40        // Logical sectors written by the test
+#define HOT_SECTORS 4          // Rewritten most of the time, the rest stays cold
+#define CUT_PERIOD 8           // One write of this many has a power cut
+
+#define CHECK(condition) \
+  do { if (!(condition)) { printf ("FAILED line %d: %s\n", __LINE__, #condition); exit (1); } } while (0)
+
+static jmp_buf powerCut;
+static uint8_t data[FTL_DATA_SIZE], readBack[FTL_DATA_SIZE];
+
+// Generation of the last completed write of every logical sector, 0 if never written
+static uint32_t committed[LOGICAL_USED];
+// Write in progress when the power was cut
+static uint16_t pendingLogical;
+static uint32_t pendingGeneration;
+
+// Erase count of a sector lost in a cut, and the difference between the real count and the header
+static uint8_t isCountLost[FTL_PHYSICAL_SECTORS];
+static int32_t countDrift[FTL_PHYSICAL_SECTORS];
+
+static void PowerCutHandler (void)
+{
+  longjmp (powerCut, 1);
+}
+
+static uint32_t DataSize (uint16_t logical)
+{
+  return (logical % 3 == 0) ? FTL_DATA_SIZE : 100 + logical * 50U;
+}
+
+static void FillData (uint8_t* buffer, uint16_t logical, uint32_t generation)
+{
+  for (uint32_t i = 0; i < DataSize (logical); i++)
+    buffer[i] = (uint8_t) (logical * 31 + generation * 7 + i * 13 + (i >> 8));
+}
+
+static uint16_t HeaderCheck (const FTL_SectorHeader_t* header)
+{
+  uint32_t check = header->eraseCount * 31 + header->version;
+
+  check = check * 31 + header->logical;
+  check ^= check >> 16;
+  return (uint16_t) ~check;
+}
+
+static const FTL_SectorHeader_t* SectorHeader (uint16_t sector)
+{
+  return (const FTL_SectorHeader_t*) (FlashSim_GetArray () + FTL_START_ADDRESS + (uint32_t) sector * FTL_SECTOR_SIZE);
+}
+
+/*
+ * Check the state rebuilt by FTL_Mount() against the flash content.
+ */
+static void CheckMount (uint8_t isAfterCut)
+{
+  uint16_t scanMap[FTL_LOGICAL_SECTORS];
+  uint32_t scanVersion[FTL_LOGICAL_SECTORS];
+  uint32_t mountCount[FTL_PHYSICAL_SECTORS];
+  uint8_t isUsed[FTL_PHYSICAL_SECTORS] = { 0 };
+  uint32_t newLost = 0, known = 0, minCount, maxCount, expectedMin, expectedMax;
+  uint64_t sum = 0;
+
+  // Full scan: the newest complete copy of every logical sector
+  memset (scanMap, 0xFF, sizeof(scanMap));
+  for (uint16_t sector = 0; sector < FTL_PHYSICAL_SECTORS; sector++)
+  {
+    const FTL_SectorHeader_t* header = SectorHeader (sector);
+    uint32_t realCount = FlashSim_GetEraseCount (FTL_START_ADDRESS / FTL_SECTOR_SIZE + sector);
+
+    mountCount[sector] = (header->eraseCount == 0xFFFFFFFF) ? 0 : 0xFFFFFFFF;
+    if (header->check != HeaderCheck (header))
+    {
+      if (realCount > 0 && !isCountLost[sector])
+      {
+	isCountLost[sector] = 1;
+	newLost++;
+      }
+      continue;
+    }
+    mountCount[sector] = header->eraseCount;
+    sum += header->eraseCount;
+    known++;
+
+    // The count of a sector which lost it is estimated, it drifts from the real one
+    if (isCountLost[sector])
+    {
+      isCountLost[sector] = 0;
+      countDrift[sector] = (int32_t) (realCount - header->eraseCount);
+    }
+    CHECK((int32_t) (realCount - header->eraseCount) == countDrift[sector]);
+
+    if (header->magic != FTL_SECTOR_MAGIC || header->logical >= FTL_LOGICAL_SECTORS) continue;
+    if (scanMap[header->logical] == 0xFFFF || header->version > scanVersion[header->logical])
+    {
+      scanMap[header->logical] = sector;
+      scanVersion[header->logical] = header->version;
+    }
+  }
+  CHECK(newLost <= (isAfterCut ? 1 : 0));
+
+  // Erase counts in RAM: from the headers, garbled ones get the average
+  expectedMin = 0xFFFFFFFF;
+  expectedMax = 0;
+  for (uint16_t sector = 0; sector < FTL_PHYSICAL_SECTORS; sector++)
+  {
+    uint32_t count = (mountCount[sector] == 0xFFFFFFFF) ? (known ? sum / known : 0) : mountCount[sector];
+    if (count < expectedMin) expectedMin = count;
+    if (count > expectedMax) expectedMax = count;
+  }
+  CHECK(FTL_GetEraseCountRange (&minCount, &maxCount));
+  CHECK(minCount == expectedMin && maxCount == expectedMax);
+
+  for (uint16_t logical = 0; logical < FTL_LOGICAL_SECTORS; logical++)
+  {
+    uint32_t address;
+
+    if (!FTL_GetDataAddress (logical, &address))
+    {
+      CHECK(scanMap[logical] == 0xFFFF);
+      continue;
+    }
+    uint16_t sector = (address - FTL_START_ADDRESS) / FTL_SECTOR_SIZE;
+    CHECK(sector == scanMap[logical]);
+    CHECK(!isUsed[sector]);
+    isUsed[sector] = 1;
+  }
+}
+
+/*
+ * Check the content of every logical sector, the interrupted write may be complete or not.
+ */
+static void CheckData (uint8_t isAfterCut)
+{
+  for (uint16_t logical = 0; logical < LOGICAL_USED; logical++)
+  {
+    uint32_t size = DataSize (logical);
+    uint8_t isPending = isAfterCut && logical == pendingLogical;
+
+    if (!FTL_Read (logical, 0, readBack, size))
+    {
+      CHECK(committed[logical] == 0);
+      continue;
+    }
+    FillData (data, logical, committed[logical]);
+    if (committed[logical] != 0 && memcmp (data, readBack, size) == 0) continue;
+
+    // Only the interrupted write may have replaced the last completed one
+    CHECK(isPending);
+    FillData (data, logical, pendingGeneration);
+    CHECK(memcmp (data, readBack, size) == 0);
+    committed[logical] = pendingGeneration;
+  }
+}
+
+int main (void)
+{
+  // Kept out of registers, longjmp() returns into the loop
+  static uint32_t write, cuts, cutsInWrite, cutsInEndWrite, cutsInRelocation, relocations, erasesBefore;
+  FlashSim_Stats_t stats;
+  uint32_t minCount, maxCount;
+
+  unlink (SIM_FILE);
+  CHECK(FlashSim_Open (SIM_FILE));
+  CHECK(Flash_Init ());
+  CHECK(FTL_Mount ());
+  srand (1);
+
+  for (write = 1; write <= WRITES; write++)
+  {
+    uint16_t logical = (write <= LOGICAL_USED) ? write - 1 : (uint16_t) ((rand () % 20 == 0) ? rand () % LOGICAL_USED : rand () % HOT_SECTORS);
+    uint32_t size = DataSize (logical);
+    uint8_t cutPhase = (write > LOGICAL_USED && rand () % CUT_PERIOD == 0) ? 1 + rand () % 2 : 0;
+
+    pendingLogical = logical;
+    pendingGeneration = write;
+    FillData (data, logical, write);
+
+    if (setjmp (powerCut) == 0)
+    {
+      // Phase 1: the erase and the programs of the new copy, up to the last data byte
+      if (cutPhase == 1) FlashSim_SetPowerCut (rand () % 160000, PowerCutHandler);
+      CHECK(FTL_BeginWrite (logical));
+      CHECK(FTL_WriteData (data, size / 2));
+      CHECK(FTL_WriteData (data + size / 2, size - size / 2));
+      FlashSim_SetPowerCut (-1, NULL);
+
+      // Phase 2: the commit and the static relocation, if any
+      FlashSim_GetStats (&stats);
+      erasesBefore = stats.erases;
+      // The commit alone is a few hundred bytes, a relocation with its erase much more
+      if (cutPhase == 2) FlashSim_SetPowerCut ((rand () % 3 == 0) ? rand () % 600 : rand () % 160000, PowerCutHandler);
+      CHECK(FTL_EndWrite ());
+      FlashSim_SetPowerCut (-1, NULL);
+
+      FlashSim_GetStats (&stats);
+      if (stats.erases != erasesBefore) relocations++;
+      committed[logical] = write;
+    }
+    else
+    {
+      // Restart after the cut, like the MCU after a reset
+      cuts++;
+      FlashSim_GetStats (&stats);
+      if (cutPhase == 1) cutsInWrite++;
+      else if (stats.erases != erasesBefore) cutsInRelocation++;
+      else cutsInEndWrite++;
+
+      CHECK(Flash_Init ());
+      CHECK(FTL_Mount ());
+      CheckMount (1);
+      CheckData (1);
+    }
+
+    if (write % 500 == 0)
+    {
+      CHECK(FTL_Mount ());
+      CheckMount (0);
+      CheckData (0);
+    }
+  }
+
+  CHECK(FTL_Mount ());
+  CheckMount (0);
+  CheckData (0);
+  CHECK(FTL_GetEraseCountRange (&minCount, &maxCount));
+  CHECK(relocations > 0 && cutsInWrite > 0 && cutsInEndWrite > 0 && cutsInRelocation > 0);
+
+  FlashSim_Close ();
+  unlink (SIM_FILE);
+  printf ("FTL test passed: %u writes, %u static relocations, %u power cuts (%u in the write, %u in the commit,"
+	  " %u in a relocation), erase counts %u..%u\n", WRITES, relocations, cuts, cutsInWrite, cutsInEndWrite,
+	  cutsInRelocation, minCount, maxCount);
+  return 0;
+}
@@ -0,0 +1,696 @@
+/*
+ * flash_sim.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ *
+ *  This file simulates the W25Q128JV flash behind the port functions of the flash driver,
+ *  so the storage code (sample log, FTL, key-value store, chart cache) runs on Linux.
+ *  Every byte clocked over the simulated SPI goes through a command decoder. The chip
+ *  follows the NOR rules: a program can only clear bits, an erase sets a whole sector
+ *  or block to 0xFF. Programs and erases run for their datasheet time on a simulated
+ *  clock and report BUSY in SR1 meanwhile, their effect on the array grows with the
+ *  elapsed time, so a suspended erase leaves a half erased sector.
+ *
+ *  A power cut can be injected before any byte of the bus. The running program or erase
+ *  stops where it is, with a torn byte at the boundary, the chip returns to its power-on
+ *  state and the handler given to FlashSim_SetPowerCut() is called. It must not return,
+ *  a test jumps back to its main loop with longjmp() and mounts the storage again.
+ *
+ *  The DMA mode of the driver is supported as well: a DMA transfer is done at once
+ *  and its complete callback is called before HAL_SPI_Transmit_DMA() returns.
+ */
+
+#include "main.h"
+#include "flash_sim.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ============================================================================
+// Definitions and Constants
+// ============================================================================
+
+#define FLASH_SIM_SECTORS	(FLASH_SIM_SIZE / FLASH_SIM_SECTOR_SIZE)
+#define FLASH_SIM_FILE_SIZE	(FLASH_SIM_SIZE + FLASH_SIM_SECTORS * sizeof(uint32_t))
+
+#define FLASH_SIM_JEDEC_ID	0xEF4018   // Winbond, W25Q SPI, 128 Mbit
+#define FLASH_SIM_DEVICE_ID	0x17
+#define FLASH_SIM_SUSPEND_US	20         // tSUS
+#define FLASH_SIM_RELEASE_US	3          // tRES1
+#define FLASH_SIM_RESET_US	30         // tRST
+
+#define SR1_BIT_WEL		0x02
+
+// ============================================================================
+// Types
+// ============================================================================
+
+typedef enum
+{
+  FLASH_SIM_OP_PROGRAM = 0,
+  FLASH_SIM_OP_ERASE
+} FlashSim_OpType_t;
+
+/*
+ * Program or erase running in the chip. Its effect is applied to the array
+ * byte by byte as the simulated time goes by.
+ */
+typedef struct
+{
+  uint8_t active;
+  uint8_t suspended;
+  FlashSim_OpType_t type;
+  uint32_t address;            // First byte of the page or of the erased area
+  uint32_t length;
+  uint32_t applied;            // Bytes already changed in the array
+  uint64_t durationNs;
+  uint64_t elapsedNs;          // Run time before the last resume
+  uint64_t resumedNs;          // Time of the start or of the last resume
+  uint64_t suspendAtNs;        // End of tSUS after a suspend command, 0 if none
+  uint8_t page[FLASH_SIM_PAGE_SIZE]; // Data of a program, 0xFF where nothing was sent
+} FlashSim_Op_t;
+
+// ============================================================================
+// Private Variables
+// ============================================================================
+
+static int simFile = -1;
+static uint8_t* simArray;              // FLASH_SIM_SIZE bytes of the chip
+static uint32_t* simEraseCounts;       // Erase count of every sector, after the array
+static uint64_t simTimeNs = 0;
+static FlashSim_Stats_t simStats;
+static FlashSim_Op_t simOp;
+
+// State of the chip
+static uint8_t isSelected = 0;
+static uint8_t isWriteEnabled = 0;
+static uint8_t isPoweredDown = 0;
+static uint8_t isResetEnabled = 0;
+static uint64_t readyAtNs = 0;         // End of a release from power down or of a reset
+
+// Transaction between a select and an unselect
+static uint32_t byteIndex;
+static uint8_t command;
+static uint8_t isIgnored;              // Command is dropped, the chip doesn't drive MISO
+static uint32_t address;
+static uint32_t programLength;
+
+// Power cut injection
+static int64_t cutCountdown = -1;
+static void (*cutHandler) (void);
+
+// HAL objects used by the driver
+GPIO_TypeDef HostGpioA, HostGpioB;
+SPI_TypeDef HostSpi1, HostSpi2;
+SPI_HandleTypeDef hspi1 = { SPI1 };
+DWT_Type HostDwt;
+CoreDebug_Type HostCoreDebug;
+uint32_t SystemCoreClock = 84000000;
+
+// ============================================================================
+// Static Helper Functions
+// ============================================================================
+
+/**
+ * @brief  Apply the running operation to the array up to a number of bytes.
+ * @param  target: Bytes of the operation which must be done.
+ * @retval None
+ */
+static void FlashSim_ApplyOp (uint32_t target)
+{
+  for (; simOp.applied < target; simOp.applied++)
+  {
+    uint32_t offset = simOp.applied;
+
+    if (simOp.type == FLASH_SIM_OP_PROGRAM)
+      simArray[simOp.address + offset] &= simOp.page[offset];
+    else
+      simArray[(simOp.address + offset) % FLASH_SIM_SIZE] = 0xFF;
+  }
+}
+
+/**
+ * @brief  Bring the running operation to the current simulated time.
+ * @retval None
+ *
+ * A suspend takes effect tSUS after its command, the operation runs until then.
+ */
+static void FlashSim_Advance (void)
+{
+  uint64_t now = simTimeNs;
+  uint64_t elapsed;
+
+  if (!simOp.active || simOp.suspended) return;
+
+  if (simOp.suspendAtNs != 0 && now > simOp.suspendAtNs) now = simOp.suspendAtNs;
+  elapsed = simOp.elapsedNs + (now - simOp.resumedNs);
+
+  if (elapsed >= simOp.durationNs)
+  {
+    FlashSim_ApplyOp (simOp.length);
+    simOp.active = 0;
+    return;
+  }
+  FlashSim_ApplyOp ((uint32_t) ((uint64_t) simOp.length * elapsed / simOp.durationNs));
+
+  if (simOp.suspendAtNs != 0 && simTimeNs >= simOp.suspendAtNs)
+  {
+    simOp.suspended = 1;
+    simOp.elapsedNs = elapsed;
+    simOp.suspendAtNs = 0;
+  }
+}
+
+/**
+ * @brief  Check if a program or an erase is running.
+ * @retval uint8_t: 1 while BUSY is set in SR1.
+ */
+static uint8_t FlashSim_IsBusy (void)
+{
+  FlashSim_Advance ();
+  return simOp.active && !simOp.suspended;
+}
+
+/**
+ * @brief  Start a program or an erase.
+ * @param  type: Operation.
+ * @param  start: First byte of the area.
+ * @param  length: Size of the area.
+ * @param  durationUs: Time the chip needs for the whole area.
+ * @retval None
+ */
+static void FlashSim_StartOp (FlashSim_OpType_t type, uint32_t start, uint32_t length, uint32_t durationUs)
+{
+  simOp.active = 1;
+  simOp.suspended = 0;
+  simOp.type = type;
+  simOp.address = start;
+  simOp.length = length;
+  simOp.applied = 0;
+  simOp.durationNs = (uint64_t) durationUs * 1000;
+  simOp.elapsedNs = 0;
+  simOp.resumedNs = simTimeNs;
+  simOp.suspendAtNs = 0;
+  isWriteEnabled = 0;
+}
+
+/**
+ * @brief  Start an erase of an aligned area, counting the erase of its sectors.
+ * @param  size: Size of the area, the low address bits are ignored like on the chip.
+ * @param  durationUs: Erase time.
+ * @retval None
+ */
+static void FlashSim_StartErase (uint32_t size, uint32_t durationUs)
+{
+  uint32_t start = (address % FLASH_SIM_SIZE) & ~(size - 1);
+
+  for (uint32_t sector = start / FLASH_SIM_SECTOR_SIZE; sector < (start + size) / FLASH_SIM_SECTOR_SIZE; sector++)
+    simEraseCounts[sector]++;
+
+  simStats.erases++;
+  FlashSim_StartOp (FLASH_SIM_OP_ERASE, start, size, durationUs);
+}
+
+/**
+ * @brief  Stop the running operation where it is, leaving a torn byte at its boundary.
+ * @retval None
+ */
+static void FlashSim_AbortOp (void)
+{
+  FlashSim_Advance ();
+  if (!simOp.active) return;
+
+  if (simOp.applied < simOp.length)
+  {
+    uint32_t offset = simOp.applied;
+    uint8_t noise = (uint8_t) rand ();
+
+    if (simOp.type == FLASH_SIM_OP_PROGRAM)
+      simArray[simOp.address + offset] &= simOp.page[offset] | noise;
+    else
+      simArray[(simOp.address + offset) % FLASH_SIM_SIZE] |= noise;
+  }
+  simOp.active = 0;
+}
+
+/**
+ * @brief  Cut the power: stop the running operation and call the handler.
+ * @retval None
+ */
+static void FlashSim_PowerCut (void)
+{
+  FlashSim_AbortOp ();
+  isSelected = 0;
+  isWriteEnabled = 0;
+  isPoweredDown = 0;
+  isResetEnabled = 0;
+  readyAtNs = 0;
+  simStats.powerCuts++;
+  cutCountdown = -1;
+
+  if (cutHandler == NULL)
+  {
+    fprintf (stderr, "flash_sim: power cut without a handler\n");
+    exit (1);
+  }
+  cutHandler ();
+  fprintf (stderr, "flash_sim: the power cut handler returned\n");
+  exit (1);
+}
+
+/**
+ * @brief  Decide at the command byte if the chip accepts the command.
+ * @retval uint8_t: 1 if the command is dropped.
+ */
+static uint8_t FlashSim_IsCommandIgnored (void)
+{
+  if (isPoweredDown)
+  {
+    if (command == W25_POWERUP_ID) return 0;
+    simStats.poweredDownCommands++;
+    return 1;
+  }
+  if (simTimeNs < readyAtNs)
+  {
+    simStats.busyCommands++;
+    return 1;
+  }
+  if (command == W25_R_SR1) return 0;
+  if (FlashSim_IsBusy ())
+  {
+    if (command == W25_EP_SUS) return 0;
+    simStats.busyCommands++;
+    return 1;
+  }
+  // Only reads are allowed while an erase is suspended
+  if (simOp.active && command != W25_READ && command != W25_FREAD && command != W25_EP_RES
+      && command != W25_EP_SUS && command != W25_JEDEC_ID)
+  {
+    simStats.busyCommands++;
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * @brief  Clock one byte over the bus.
+ * @param  mosi: Byte sent by the MCU.
+ * @retval uint8_t: Byte sent by the chip.
+ */
+static uint8_t FlashSim_Exchange (uint8_t mosi)
+{
+  uint32_t index;
+  uint8_t miso = 0xFF;
+
+  if (cutCountdown >= 0 && cutCountdown-- == 0) FlashSim_PowerCut ();
+  simTimeNs += FLASH_SIM_BYTE_NS;
+  if (!isSelected) return 0xFF;
+
+  index = byteIndex++;
+  if (index == 0)
+  {
+    command = mosi;
+    address = 0;
+    programLength = 0;
+    isIgnored = FlashSim_IsCommandIgnored ();
+    return miso;
+  }
+  if (isIgnored) return miso;
+
+  switch (command)
+  {
+    case W25_READ:
+    case W25_FREAD:
+    case W25_PAGE_P:
+    case W25_S_ERASE4K:
+    case W25_B_ERASE32K:
+    case W25_B_ERASE64K:
+    case W25_R_SFPD_REG:
+      if (index <= 3)
+      {
+	address = (address << 8) | mosi;
+	break;
+      }
+      if (command == W25_READ)
+      {
+	miso = simArray[(address + index - 4) % FLASH_SIM_SIZE];
+      }
+      else if (command == W25_FREAD && index >= 5)
+      {
+	miso = simArray[(address + index - 5) % FLASH_SIM_SIZE];
+      }
+      else if (command == W25_R_SFPD_REG && index >= 5)
+      {
+	static const uint8_t sfdpHeader[8] = { 'S', 'F', 'D', 'P', 0x05, 0x01, 0x00, 0xFF };
+	uint32_t offset = (address + index - 5) & 0xFF;
+	miso = (offset < sizeof(sfdpHeader)) ? sfdpHeader[offset] : 0xFF;
+      }
+      else if (command == W25_PAGE_P)
+      {
+	// The page address counter wraps inside the page
+	if (programLength == 0) memset (simOp.page, 0xFF, sizeof(simOp.page));
+	if (programLength == FLASH_SIM_PAGE_SIZE - (address % FLASH_SIM_PAGE_SIZE)) simStats.pageWraps++;
+	simOp.page[(address + programLength) % FLASH_SIM_PAGE_SIZE] &= mosi;
+	programLength++;
+      }
+      break;
+
+    case W25_R_SR1:
+      miso = (FlashSim_IsBusy () ? SR1_BIT_BUSY : 0) | (isWriteEnabled ? SR1_BIT_WEL : 0);
+      break;
+
+    case W25_JEDEC_ID:
+      if (index <= 3) miso = (FLASH_SIM_JEDEC_ID >> (8 * (3 - index))) & 0xFF;
+      break;
+
+    case W25_POWERUP_ID:
+      if (index >= 4) miso = FLASH_SIM_DEVICE_ID;
+      break;
+
+    default:
+      break;
+  }
+  return miso;
+}
+
+/**
+ * @brief  Run the command of a transaction when the chip is unselected.
+ * @retval None
+ */
+static void FlashSim_EndCommand (void)
+{
+  uint8_t isReset = (command == W25_RESET && isResetEnabled);
+
+  if (byteIndex == 0) return;
+  simStats.commands++;
+  isResetEnabled = 0;
+  if (isIgnored) return;
+
+  switch (command)
+  {
+    case W25_W_ENABLE:
+      isWriteEnabled = 1;
+      break;
+
+    case W25_PAGE_P:
+    case W25_S_ERASE4K:
+    case W25_B_ERASE32K:
+    case W25_B_ERASE64K:
+    case W25_CH_ERASE:
+      if (!isWriteEnabled)
+      {
+	simStats.noWriteEnable++;
+	break;
+      }
+      if (command == W25_PAGE_P)
+      {
+	if (byteIndex < 5) break;
+	simStats.pagePrograms++;
+	for (uint32_t i = 0; i < FLASH_SIM_PAGE_SIZE; i++)
+	{
+	  uint32_t target = ((address & ~(FLASH_SIM_PAGE_SIZE - 1)) + i) % FLASH_SIM_SIZE;
+	  if (simOp.page[i] & ~simArray[target]) simStats.setBits++;
+	}
+	FlashSim_StartOp (FLASH_SIM_OP_PROGRAM, (address % FLASH_SIM_SIZE) & ~(FLASH_SIM_PAGE_SIZE - 1),
+			  FLASH_SIM_PAGE_SIZE, FLASH_SIM_PROGRAM_US);
+      }
+      else if (command == W25_S_ERASE4K && byteIndex >= 4)
+	FlashSim_StartErase (FLASH_SIM_SECTOR_SIZE, FLASH_SIM_ERASE4K_US);
+      else if (command == W25_B_ERASE32K && byteIndex >= 4)
+	FlashSim_StartErase (0x8000, FLASH_SIM_ERASE32K_US);
+      else if (command == W25_B_ERASE64K && byteIndex >= 4)
+	FlashSim_StartErase (0x10000, FLASH_SIM_ERASE64K_US);
+      else if (command == W25_CH_ERASE)
+      {
+	address = 0;
+	FlashSim_StartErase (FLASH_SIM_SIZE, FLASH_SIM_CHIP_ERASE_US);
+      }
+      break;
+
+    case W25_EP_SUS:
+      if (simOp.active && !simOp.suspended && simOp.suspendAtNs == 0)
+	simOp.suspendAtNs = simTimeNs + FLASH_SIM_SUSPEND_US * 1000;
+      break;
+
+    case W25_EP_RES:
+      FlashSim_Advance ();
+      if (simOp.active && simOp.suspended)
+      {
+	simOp.suspended = 0;
+	simOp.resumedNs = simTimeNs;
+      }
+      break;
+
+    case W25_POWERDOWN:
+      isPoweredDown = 1;
+      break;
+
+    case W25_POWERUP_ID:
+      if (isPoweredDown)
+      {
+	isPoweredDown = 0;
+	readyAtNs = simTimeNs + FLASH_SIM_RELEASE_US * 1000;
+      }
+      break;
+
+    case W25_RESET_EN:
+      isResetEnabled = 1;
+      break;
+
+    case W25_RESET:
+      if (isReset)
+      {
+	FlashSim_AbortOp ();
+	isWriteEnabled = 0;
+	readyAtNs = simTimeNs + FLASH_SIM_RESET_US * 1000;
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief  Clock a buffer over the bus.
+ * @param  tx: Bytes sent, NULL to send dummy bytes.
+ * @param  rx: Bytes received, NULL to drop them.
+ * @param  size: Number of bytes.
+ * @retval None
+ */
+static void FlashSim_Transfer (const uint8_t* tx, uint8_t* rx, uint32_t size)
+{
+  for (uint32_t i = 0; i < size; i++)
+  {
+    uint8_t miso = FlashSim_Exchange (tx ? tx[i] : W25_DUMMY);
+    if (rx) rx[i] = miso;
+  }
+}
+
+// ============================================================================
+// Public Functions
+// ============================================================================
+
+/**
+ * @brief  Open the file backing the chip, created erased when it doesn't exist.
+ * @param  path: Path of the file.
+ * @retval uint8_t: 1 on success, 0 on a file error.
+ */
+uint8_t FlashSim_Open (const char* path)
+{
+  struct stat fileStat;
+  uint8_t* file;
+
+  simFile = open (path, O_RDWR | O_CREAT, 0644);
+  if (simFile < 0 || fstat (simFile, &fileStat) != 0) return 0;
+
+  uint8_t isNew = (fileStat.st_size != (off_t) FLASH_SIM_FILE_SIZE);
+  if (isNew && ftruncate (simFile, FLASH_SIM_FILE_SIZE) != 0) return 0;
+
+  file = mmap (NULL, FLASH_SIM_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, simFile, 0);
+  if (file == MAP_FAILED) return 0;
+
+  simArray = file;
+  simEraseCounts = (uint32_t*) (file + FLASH_SIM_SIZE);
+  if (isNew)
+  {
+    memset (simArray, 0xFF, FLASH_SIM_SIZE);
+    memset (simEraseCounts, 0, FLASH_SIM_SECTORS * sizeof(uint32_t));
+  }
+
+  memset (&simStats, 0, sizeof(simStats));
+  memset (&simOp, 0, sizeof(simOp));
+  return 1;
+}
+
+/**
+ * @brief  Finish the running operation and write the file.
+ * @retval None
+ */
+void FlashSim_Close (void)
+{
+  if (simFile < 0) return;
+
+  if (simOp.active)
+  {
+    simOp.suspended = 0;
+    FlashSim_ApplyOp (simOp.length);
+    simOp.active = 0;
+  }
+  msync (simArray, FLASH_SIM_FILE_SIZE, MS_SYNC);
+  munmap (simArray, FLASH_SIM_FILE_SIZE);
+  close (simFile);
+  simFile = -1;
+}
+
+/**
+ * @brief  Direct access to the array, to check or to damage its content.
+ * @retval uint8_t*: FLASH_SIM_SIZE bytes.
+ */
+uint8_t* FlashSim_GetArray (void)
+{
+  return simArray;
+}
+
+/**
+ * @brief  Get the number of erases of a sector, kept in the backing file.
+ * @param  sector: Index of the 4 KB sector.
+ * @retval uint32_t: Erase count.
+ */
+uint32_t FlashSim_GetEraseCount (uint32_t sector)
+{
+  return (sector < FLASH_SIM_SECTORS) ? simEraseCounts[sector] : 0;
+}
+
+/**
+ * @brief  Get the simulated time: bus transfers, waits and chip operations.
+ * @retval uint64_t: Time since the start in ns.
+ */
+uint64_t FlashSim_GetTimeNs (void)
+{
+  return simTimeNs;
+}
+
+/**
+ * @brief  Copy the counters of the simulator.
+ * @param  stats: Counters.
+ * @retval None
+ */
+void FlashSim_GetStats (FlashSim_Stats_t* stats)
+{
+  *stats = simStats;
+}
+
+/**
+ * @brief  Schedule a power cut.
+ * @param  bytes: Bytes of the bus transferred before the cut, -1 cancels it.
+ * @param  handler: Called after the cut, it must not return.
+ * @retval None
+ */
+void FlashSim_SetPowerCut (int64_t bytes, void (*handler) (void))
+{
+  cutCountdown = bytes;
+  cutHandler = handler;
+}
+
+// ============================================================================
+// Flash Driver Port
+// ============================================================================
+
+void Flash_PortSetSelected (uint8_t selected)
+{
+  if (selected && !isSelected)
+  {
+    isSelected = 1;
+    byteIndex = 0;
+  }
+  else if (!selected && isSelected)
+  {
+    isSelected = 0;
+    FlashSim_EndCommand ();
+  }
+}
+
+uint8_t Flash_PortIsSelected (void)
+{
+  return isSelected;
+}
+
+void Flash_PortTransmit (uint8_t* data, uint16_t dataSize)
+{
+  FlashSim_Transfer (data, NULL, dataSize);
+}
+
+void Flash_PortReceive (uint8_t* data, uint16_t dataSize)
+{
+  FlashSim_Transfer (NULL, data, dataSize);
+}
+
+void Flash_PortDelayUs (uint32_t us)
+{
+  simTimeNs += (uint64_t) us * 1000;
+}
+
+// ============================================================================
+// HAL
+// ============================================================================
+
+/**
+ * @brief  Simulated tick, every call takes 1 us so polling loops end.
+ * @retval uint32_t: Time in ms.
+ */
+uint32_t HAL_GetTick (void)
+{
+  simTimeNs += 1000;
+  return (uint32_t) (simTimeNs / 1000000);
+}
+
+void HAL_GPIO_WritePin (GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state)
+{
+  if (state == GPIO_PIN_SET)
+    port->ODR |= pin;
+  else
+    port->ODR &= ~pin;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin (GPIO_TypeDef* port, uint16_t pin)
+{
+  return (port->ODR & pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit (SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size, uint32_t timeout)
+{
+  (void) timeout;
+  if (hspi->Instance != SPI1) return HAL_ERROR;
+  FlashSim_Transfer (data, NULL, size);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive (SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size, uint32_t timeout)
+{
+  (void) timeout;
+  if (hspi->Instance != SPI1) return HAL_ERROR;
+  FlashSim_Transfer (NULL, data, size);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA (SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size)
+{
+  if (hspi->Instance != SPI1) return HAL_ERROR;
+  FlashSim_Transfer (data, NULL, size);
+  HAL_SPI_TxCpltCallback (hspi);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive_DMA (SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size)
+{
+  if (hspi->Instance != SPI1) return HAL_ERROR;
+  FlashSim_Transfer (NULL, data, size);
+  HAL_SPI_RxCpltCallback (hspi);
+  return HAL_OK;
+}
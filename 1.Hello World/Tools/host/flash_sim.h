@@ -0,0 +1,56 @@
+/*
+ * flash_sim.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ */
+
+#ifndef HOST_FLASH_SIM_H_
+#define HOST_FLASH_SIM_H_
+
+#include <stdint.h>
+
+/*
+ * W25Q128JV simulator for host builds of the flash driver. It replaces the weak
+ * Flash_Port* functions of z_flash_W25QXXX.c and the HAL SPI calls of its DMA mode,
+ * and decodes the commands the driver sends. The array lives in a memory mapped file,
+ * followed by the erase count of every 4 KB sector, so both survive between runs.
+ */
+#define FLASH_SIM_SIZE		0x01000000 // 16 MB, reported by the JEDEC ID
+#define FLASH_SIM_SECTOR_SIZE	0x1000
+#define FLASH_SIM_PAGE_SIZE	0x100
+
+// Timings of the chip (typical values of the datasheet) and of the SPI bus
+#define FLASH_SIM_BYTE_NS	381        // One byte at 21 MHz
+#define FLASH_SIM_PROGRAM_US	400        // tPP
+#define FLASH_SIM_ERASE4K_US	45000      // tSE
+#define FLASH_SIM_ERASE32K_US	120000     // tBE1
+#define FLASH_SIM_ERASE64K_US	150000     // tBE2
+#define FLASH_SIM_CHIP_ERASE_US	40000000   // tCE
+
+/*
+ * Misuse of the chip noticed by the simulator. The real chip ignores such commands
+ * or programs something else than intended, the simulator does the same and counts them.
+ */
+typedef struct
+{
+  uint32_t commands;           // Transactions between a select and an unselect
+  uint32_t pagePrograms;
+  uint32_t erases;
+  uint32_t busyCommands;       // Commands other than a status read or a suspend while busy
+  uint32_t noWriteEnable;      // Programs and erases without a write enable
+  uint32_t pageWraps;          // Programs crossing a page boundary, wrapped to the page start
+  uint32_t setBits;            // Bits a program tried to change from 0 to 1
+  uint32_t poweredDownCommands; // Commands other than a release while powered down
+  uint32_t powerCuts;
+} FlashSim_Stats_t;
+
+uint8_t FlashSim_Open (const char* path);
+void FlashSim_Close (void);
+uint8_t* FlashSim_GetArray (void);
+uint32_t FlashSim_GetEraseCount (uint32_t sector);
+uint64_t FlashSim_GetTimeNs (void);
+void FlashSim_GetStats (FlashSim_Stats_t* stats);
+void FlashSim_SetPowerCut (int64_t bytes, void (*handler) (void));
+
+#endif /* HOST_FLASH_SIM_H_ */
@@ -0,0 +1,164 @@
+/*
+ * stm32f4xx_hal.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: piotr
+ *
+ *  Host stand-in for the STM32 HAL, found before the real one when Tools/host is
+ *  on the include path. It declares only what Core/Inc/main.h, the flash driver and
+ *  the storage modules need, so they compile unchanged on Linux. The functions are
+ *  provided by Tools/host/flash_sim.c, the RTC backup registers by the test using them.
+ */
+
+#ifndef HOST_STM32F4XX_HAL_H_
+#define HOST_STM32F4XX_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __weak			__attribute__((weak))
+#define HAL_MAX_DELAY		0xFFFFFFFFU
+
+typedef enum
+{
+  HAL_OK = 0,
+  HAL_ERROR,
+  HAL_BUSY,
+  HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+  uint32_t ODR;
+} GPIO_TypeDef;
+
+extern GPIO_TypeDef HostGpioA, HostGpioB;
+#define GPIOA			(&HostGpioA)
+#define GPIOB			(&HostGpioB)
+
+#define GPIO_PIN_0		((uint16_t) 0x0001)
+#define GPIO_PIN_1		((uint16_t) 0x0002)
+#define GPIO_PIN_2		((uint16_t) 0x0004)
+#define GPIO_PIN_4		((uint16_t) 0x0010)
+#define GPIO_PIN_5		((uint16_t) 0x0020)
+#define GPIO_PIN_6		((uint16_t) 0x0040)
+#define GPIO_PIN_7		((uint16_t) 0x0080)
+#define GPIO_PIN_9		((uint16_t) 0x0200)
+#define GPIO_PIN_10		((uint16_t) 0x0400)
+#define GPIO_PIN_12		((uint16_t) 0x1000)
+#define GPIO_PIN_13		((uint16_t) 0x2000)
+#define GPIO_PIN_14		((uint16_t) 0x4000)
+#define GPIO_PIN_15		((uint16_t) 0x8000)
+
+void HAL_GPIO_WritePin (GPIO_TypeDef* port, uint16_t pin, GPIO_PinState state);
+GPIO_PinState HAL_GPIO_ReadPin (GPIO_TypeDef* port, uint16_t pin);
+
+// ============================================================================
+// SPI
+// ============================================================================
+
+typedef struct
+{
+  uint32_t id;
+} SPI_TypeDef;
+
+extern SPI_TypeDef HostSpi1, HostSpi2;
+#define SPI1			(&HostSpi1)
+#define SPI2			(&HostSpi2)
+
+typedef struct
+{
+  SPI_TypeDef* Instance;
+} SPI_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_SPI_Transmit (SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_Receive (SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA (SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size);
+HAL_StatusTypeDef HAL_SPI_Receive_DMA (SPI_HandleTypeDef* hspi, uint8_t* data, uint16_t size);
+void HAL_SPI_TxCpltCallback (SPI_HandleTypeDef* hspi);
+void HAL_SPI_RxCpltCallback (SPI_HandleTypeDef* hspi);
+
+// ============================================================================
+// I2C
+// ============================================================================
+
+typedef struct
+{
+  uint32_t id;
+} I2C_HandleTypeDef;
+
+// ============================================================================
+// RTC
+// ============================================================================
+
+typedef struct
+{
+  uint32_t id;
+} RTC_HandleTypeDef;
+
+typedef struct
+{
+  uint8_t Hours;
+  uint8_t Minutes;
+  uint8_t Seconds;
+} RTC_TimeTypeDef;
+
+typedef struct
+{
+  uint8_t WeekDay;
+  uint8_t Month;
+  uint8_t Date;
+  uint8_t Year;
+} RTC_DateTypeDef;
+
+#define RTC_BKP_DR0		0x00000000U
+#define RTC_BKP_DR1		0x00000001U
+#define RTC_BKP_DR2		0x00000002U
+#define RTC_BKP_DR3		0x00000003U
+#define RTC_BKP_DR4		0x00000004U
+#define RTC_BKP_DR19		0x00000013U
+
+uint32_t HAL_RTCEx_BKUPRead (RTC_HandleTypeDef* hrtc, uint32_t backupRegister);
+void HAL_RTCEx_BKUPWrite (RTC_HandleTypeDef* hrtc, uint32_t backupRegister, uint32_t data);
+
+// ============================================================================
+// Core
+// ============================================================================
+
+typedef struct
+{
+  uint32_t CTRL;
+  uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+  uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type HostDwt;
+extern CoreDebug_Type HostCoreDebug;
+#define DWT			(&HostDwt)
+#define CoreDebug		(&HostCoreDebug)
+#define DWT_CTRL_CYCCNTENA_Msk		(1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk	(1UL << 24)
+
+extern uint32_t SystemCoreClock;
+
+// A host test is single threaded, the DMA callbacks run before the transfer functions return
+static inline void __disable_irq (void) {}
+static inline void __enable_irq (void) {}
+
+uint32_t HAL_GetTick (void);
+
+#endif /* HOST_STM32F4XX_HAL_H_ */
@@ -0,0 +1,103 @@
+/*
+ * led_encode_bench.c
+ *
+ * Host micro-benchmark of the WS2812B bit expansion in Core/Src/led_ws2812b.c:
+ * the bit by bit encoder against the nibble lookup table. Both encoders are copies
+ * of the firmware ones, keep them in sync. The numbers on the target come from
+ * the "LED BENCHMARK" command, which counts cycles with the DWT.
+ *
+ * Build and run:
+ *     cc -O2 -o led_encode_bench led_encode_bench.c && ./led_encode_bench
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define LED_BITS_PER_LED 24
+#define LED_LOGICAL_ONE 18
+#define LED_LOGICAL_ZERO 6
+
+#define RUNS 20000000UL
+
+// Keeps the compiler from dropping the encoded values
+volatile uint16_t sink;
+
+typedef struct
+{
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} rgb_color;
+
+#define LED_NIBBLE_SLOT(n, k) ((uint64_t) ((((n) >> (3 - (k))) & 1) ? LED_LOGICAL_ONE : LED_LOGICAL_ZERO) << (16 * (k)))
+#define LED_NIBBLE_PATTERN(n) (LED_NIBBLE_SLOT (n, 0) | LED_NIBBLE_SLOT (n, 1) | LED_NIBBLE_SLOT (n, 2) | LED_NIBBLE_SLOT (n, 3))
+
+static const uint64_t ledNibblePatterns[16] =
+{ LED_NIBBLE_PATTERN (0), LED_NIBBLE_PATTERN (1), LED_NIBBLE_PATTERN (2), LED_NIBBLE_PATTERN (3),
+    LED_NIBBLE_PATTERN (4), LED_NIBBLE_PATTERN (5), LED_NIBBLE_PATTERN (6), LED_NIBBLE_PATTERN (7),
+    LED_NIBBLE_PATTERN (8), LED_NIBBLE_PATTERN (9), LED_NIBBLE_PATTERN (10), LED_NIBBLE_PATTERN (11),
+    LED_NIBBLE_PATTERN (12), LED_NIBBLE_PATTERN (13), LED_NIBBLE_PATTERN (14), LED_NIBBLE_PATTERN (15) };
+
+static void LED_EncodeLed (uint64_t *slots, rgb_color color)
+{
+  slots[0] = ledNibblePatterns[color.g >> 4];
+  slots[1] = ledNibblePatterns[color.g & 0x0F];
+  slots[2] = ledNibblePatterns[color.r >> 4];
+  slots[3] = ledNibblePatterns[color.r & 0x0F];
+  slots[4] = ledNibblePatterns[color.b >> 4];
+  slots[5] = ledNibblePatterns[color.b & 0x0F];
+}
+
+static void LED_EncodeLedBitwise (uint16_t *slots, rgb_color color)
+{
+  uint32_t bits = ((uint32_t) color.g << 16) | ((uint32_t) color.r << 8) | color.b;
+
+  for (int bit = 0; bit < LED_BITS_PER_LED; bit++)
+  {
+    slots[bit] = (bits & (1UL << (LED_BITS_PER_LED - 1 - bit))) ? LED_LOGICAL_ONE : LED_LOGICAL_ZERO;
+  }
+}
+
+int main (void)
+{
+  uint16_t reference[LED_BITS_PER_LED];
+  uint64_t encoded[LED_BITS_PER_LED / 4];
+  clock_t start;
+  double bitwiseNs, tableNs;
+
+  // Every color must be encoded the same way
+  for (uint32_t i = 0; i < (1UL << 24); i++)
+  {
+    rgb_color color = { i >> 16, i >> 8, i };
+    LED_EncodeLedBitwise (reference, color);
+    LED_EncodeLed (encoded, color);
+    if (memcmp (reference, encoded, sizeof(reference)) != 0)
+    {
+      printf ("Encoders differ for color 0x%06lX\n", (unsigned long) i);
+      return 1;
+    }
+  }
+
+  start = clock ();
+  for (uint32_t i = 0; i < RUNS; i++)
+  {
+    rgb_color color = { i * 7, i * 13, i * 29 };
+    LED_EncodeLedBitwise (reference, color);
+    sink = reference[i % LED_BITS_PER_LED];
+  }
+  bitwiseNs = (double) (clock () - start) * 1e9 / CLOCKS_PER_SEC / RUNS;
+
+  start = clock ();
+  for (uint32_t i = 0; i < RUNS; i++)
+  {
+    rgb_color color = { i * 7, i * 13, i * 29 };
+    LED_EncodeLed (encoded, color);
+    sink = (uint16_t) encoded[i % (LED_BITS_PER_LED / 4)];
+  }
+  tableNs = (double) (clock () - start) * 1e9 / CLOCKS_PER_SEC / RUNS;
+
+  printf ("ns per LED: bitwise = %.2f, table = %.2f, speed-up = %.1fx\n", bitwiseNs, tableNs, bitwiseNs / tableNs);
+  return 0;
+}
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+slog_export.py
+
+Host side of the "LOG EXPORT" command: receives the sample log of the phone stand
+as binary frames and writes the decoded records as CSV.
+
+Usage:
+    slog_export.py /dev/ttyACM0 history.csv [FROM]   read from the device (needs pyserial)
+    slog_export.py --file capture.bin history.csv    decode a saved capture
+
+FROM is the sector sequence number to start with. It is printed at the end of every
+export, pass it to the next run to fetch only the new records. Records already present
+in the CSV file are skipped, so the file can be appended to.
+"""
+
+import struct
+import sys
+import zlib
+
+FRAME_MAGIC = 0x58454C53          # "SLEX"
+FRAME_HEADER = struct.Struct("<IIHH")
+
+SECTOR_SIZE = 0x1000
+SECTOR_MAGIC = 0x32474C53         # "SLG2"
+SECTOR_HEADER = struct.Struct("<III4i4x")
+FOOTER_SIZE = 64
+CHECK_BITS = 4
+NOMINAL_INTERVAL = 600
+
+VALUE_SCALE = (100, 100, 100, 1)
+TIMESTAMP_CODE_BITS = (0, 7, 9, 12, 32)
+VALUE_CODE_BITS = (0, 5, 8, 12, 32)
+
+CSV_HEADER = "epoch_seconds,temperature,humidity,pressure,battery_level\n"
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.position = 0
+
+    def read(self, count):
+        if self.position + count > len(self.data) * 8:
+            raise EOFError
+        value = 0
+        for _ in range(count):
+            byte = self.data[self.position // 8]
+            value = (value << 1) | ((byte >> (7 - self.position % 8)) & 1)
+            self.position += 1
+        return value
+
+    def read_code(self, code_bits):
+        code = 0
+        while code < len(code_bits) - 1 and self.read(1) == 1:
+            code += 1
+        zigzag = self.read(code_bits[code])
+        return (zigzag >> 1) ^ -(zigzag & 1)
+
+
+def checksum(epoch, values):
+    check = epoch
+    for value in values:
+        check = (check * 31 + (value & 0xFFFFFFFF)) & 0xFFFFFFFF
+    check ^= check >> 16
+    check ^= check >> 8
+    check ^= check >> 4
+    return check & ((1 << CHECK_BITS) - 1)
+
+
+def decode_sector(sector):
+    """Yield (epoch, values) for every record of a log sector, see sample_log.c"""
+    magic, _, epoch, *values = SECTOR_HEADER.unpack_from(sector)
+    if magic != SECTOR_MAGIC:
+        return
+    delta = NOMINAL_INTERVAL
+    yield epoch, values
+
+    reader = BitReader(sector[SECTOR_HEADER.size:SECTOR_SIZE - FOOTER_SIZE])
+    try:
+        while reader.read(1) == 0:
+            delta += reader.read_code(TIMESTAMP_CODE_BITS)
+            next_epoch = (epoch + delta) & 0xFFFFFFFF
+            next_values = [v + reader.read_code(VALUE_CODE_BITS) for v in values]
+            if reader.read(CHECK_BITS) != checksum(next_epoch, next_values):
+                return  # Damaged record, the device starts a new sector after it
+            epoch, values = next_epoch, next_values
+            yield epoch, values
+    except EOFError:
+        return
+
+
+def read_frames(stream):
+    """Yield (sequence, payload) for every frame, the end frame has payload None"""
+    while True:
+        # Synchronize on the magic number, text output may precede the first frame
+        window = b""
+        while window != struct.pack("<I", FRAME_MAGIC):
+            byte = stream.read(1)
+            if not byte:
+                return
+            window = (window + byte)[-4:]
+        rest = stream.read(FRAME_HEADER.size - 4)
+        header = window + rest
+        _, sequence, length, _ = FRAME_HEADER.unpack(header)
+        payload = stream.read(length)
+        crc, = struct.unpack("<I", stream.read(4))
+        if zlib.crc32(header + payload) != crc:
+            raise ValueError("CRC error in frame %d" % sequence)
+        if length == 0:
+            yield sequence, None
+            return
+        yield sequence, payload
+
+
+def export(stream, output):
+    last_epoch = 0
+    try:
+        with open(output) as csv:
+            for line in csv.readlines()[1:]:
+                last_epoch = max(last_epoch, int(line.split(",")[0]))
+        mode = "a"
+    except (OSError, ValueError, IndexError):
+        mode = "w"
+
+    resume = None
+    count = 0
+    with open(output, mode) as csv:
+        if mode == "w":
+            csv.write(CSV_HEADER)
+        for sequence, payload in read_frames(stream):
+            if payload is None:
+                resume = sequence
+                break
+            for epoch, values in decode_sector(payload):
+                if epoch <= last_epoch:
+                    continue
+                fields = [str(epoch)] + ["%g" % (v / s) for v, s in zip(values, VALUE_SCALE)]
+                csv.write(",".join(fields) + "\n")
+                last_epoch = epoch
+                count += 1
+
+    print("%d new records written to %s" % (count, output))
+    if resume is not None:
+        print("Next export: FROM=%d" % resume)
+
+
+def main(argv):
+    if len(argv) >= 4 and argv[1] == "--file":
+        with open(argv[2], "rb") as stream:
+            export(stream, argv[3])
+        return 0
+
+    if len(argv) < 3:
+        print(__doc__)
+        return 1
+
+    import serial  # pyserial
+
+    start = int(argv[3]) if len(argv) > 3 else 0
+    with serial.Serial(argv[1], timeout=5) as port:
+        port.reset_input_buffer()
+        port.write(b"LOG EXPORT FROM=%d\n" % start)
+        export(port, argv[2])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,228 @@
+/*
+ * slog_stats_test.c
+ *
+ * Host test of the range statistics of the sample log (Core/Src/sample_log.c) on the
+ * W25Q simulator of Tools/host. Records are appended through the backup register queue
+ * until the log spans a few dozen sectors, then SLOG_GetStats() is compared with
+ * a brute force pass over SLOG_ReadRange() for ranges which start and end at the sector
+ * edges, one second around them, inside the head sector and at random places.
+ * Ranges covering whole sectors must be served from the footers, so they have to be
+ * much cheaper than decoding the records.
+ *
+ * Build and run from the project directory:
+ *     cc -O2 -I Tools/host -I Core/Inc -o slog_stats_test Tools/slog_stats_test.c \
+ *         Tools/host/flash_sim.c Core/Src/z_flash_W25QXXX.c Core/Src/sample_log.c -lm && ./slog_stats_test
+ */
+
+#include "main.h"
+#include "sample_log.h"
+#include "flash_sim.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SIM_FILE "slog_stats_test.bin"
+#define RECORDS 24000
+#define FIRST_EPOCH 800000000
+#define RANDOM_RANGES 300
+
+#define CHECK(condition) \
+  do { if (!(condition)) { printf ("FAILED line %d: %s\n", __LINE__, #condition); exit (1); } } while (0)
+
+// Fixed point scale of the log, in the order of SLOG_Stats_t
+static const float scale[SLOG_VALUE_COUNT] = { 100, 100, 100, 1 };
+
+RTC_HandleTypeDef hrtc;
+static uint32_t backupRegisters[20];
+
+uint32_t HAL_RTCEx_BKUPRead (RTC_HandleTypeDef* rtc, uint32_t backupRegister)
+{
+  (void) rtc;
+  return backupRegisters[backupRegister];
+}
+
+void HAL_RTCEx_BKUPWrite (RTC_HandleTypeDef* rtc, uint32_t backupRegister, uint32_t data)
+{
+  (void) rtc;
+  backupRegisters[backupRegister] = data;
+}
+
+/*
+ * Statistics of a range collected record by record, in fixed point
+ */
+typedef struct
+{
+  uint32_t count;
+  int32_t min[SLOG_VALUE_COUNT];
+  int32_t max[SLOG_VALUE_COUNT];
+  int64_t sum[SLOG_VALUE_COUNT];
+} Reference_t;
+
+static void CollectRecord (const CHARTS_t* record, void* context)
+{
+  Reference_t* reference = (Reference_t*) context;
+  float source[SLOG_VALUE_COUNT] =
+  { record->temperature, record->humidity, record->pressure, record->battery_level };
+
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    int32_t value = (int32_t) lroundf (source[i] * scale[i]);
+
+    if (reference->count == 0 || value < reference->min[i]) reference->min[i] = value;
+    if (reference->count == 0 || value > reference->max[i]) reference->max[i] = value;
+    reference->sum[i] += value;
+  }
+  reference->count++;
+}
+
+static void CheckRange (uint32_t startEpoch, uint32_t endEpoch)
+{
+  Reference_t reference;
+  SLOG_Stats_t stats;
+
+  memset (&reference, 0, sizeof(reference));
+  CHECK(SLOG_ReadRange (startEpoch, endEpoch, CollectRecord, &reference) == reference.count);
+  CHECK(SLOG_GetStats (startEpoch, endEpoch, &stats) == reference.count);
+  CHECK(stats.count == reference.count);
+  if (reference.count == 0) return;
+
+  for (uint8_t i = 0; i < SLOG_VALUE_COUNT; i++)
+  {
+    float mean = (float) reference.sum[i] / reference.count / scale[i];
+
+    CHECK(lroundf (stats.min[i] * scale[i]) == reference.min[i]);
+    CHECK(lroundf (stats.max[i] * scale[i]) == reference.max[i]);
+    CHECK(fabsf (stats.mean[i] - mean) <= fabsf (mean) * 1e-5f + 1e-5f);
+  }
+}
+
+/*
+ * Read the first and the last epoch of a sector of the log from the simulated array
+ */
+static void SectorEpochs (uint32_t sequence, uint32_t* firstEpoch, uint32_t* lastEpoch)
+{
+  const SLOG_SectorHeader_t* header;
+  const SLOG_SectorFooter_t* footer;
+  uint32_t address;
+
+  CHECK(SLOG_GetSectorAddress (sequence, &address));
+  header = (const SLOG_SectorHeader_t*) (FlashSim_GetArray () + address);
+  footer = (const SLOG_SectorFooter_t*) (FlashSim_GetArray () + address + SLOG_SECTOR_SIZE - sizeof(SLOG_SectorFooter_t));
+  *firstEpoch = header->first_epoch;
+  *lastEpoch = footer->last_epoch;
+}
+
+static void AppendRecords (uint32_t count)
+{
+  static uint32_t epoch = FIRST_EPOCH;
+  static float temperature = 21.0f, humidity = 45.0f, pressure = 1013.0f, battery = 90.0f;
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    CHARTS_t record;
+
+    // Mostly slow drifts, now and then a jump or a late sample
+    epoch += 600 + ((rand () % 10 == 0) ? rand () % 300 : 0);
+    temperature += (rand () % 41 - 20) / 100.0f;
+    humidity += (rand () % 61 - 30) / 100.0f;
+    pressure += (rand () % 21 - 10) / 100.0f;
+    if (rand () % 200 == 0) temperature += (rand () % 2) ? 8.0f : -8.0f;
+    if (temperature < -30.0f || temperature > 50.0f) temperature = 20.0f;
+    if (humidity < 5.0f || humidity > 95.0f) humidity = 50.0f;
+    if (rand () % 100 == 0) battery = (battery > 10.0f) ? battery - 1.0f : 100.0f;
+
+    memset (&record, 0, sizeof(record));
+    record.epoch_seconds = epoch;
+    record.temperature = temperature;
+    record.humidity = humidity;
+    record.pressure = pressure;
+    record.battery_level = battery;
+    SLOG_Append (&record);
+  }
+}
+
+int main (void)
+{
+  uint32_t oldest, newest, firstEpoch, lastEpoch, headFirstEpoch, endEpoch, ranges = 0;
+  uint64_t start, statsTime, readTime;
+  Reference_t reference;
+  SLOG_Stats_t stats;
+
+  unlink (SIM_FILE);
+  CHECK(FlashSim_Open (SIM_FILE));
+  CHECK(Flash_Init ());
+  SLOG_Mount ();
+  srand (1);
+
+  // An empty log
+  CHECK(SLOG_GetStats (0, 0xFFFFFFFF, &stats) == 0 && stats.count == 0);
+
+  AppendRecords (RECORDS);
+  CHECK(SLOG_GetSequenceRange (&oldest, &newest) && newest - oldest >= 20);
+  SectorEpochs (oldest, &firstEpoch, &lastEpoch);
+  SectorEpochs (newest, &headFirstEpoch, &lastEpoch);
+  endEpoch = FIRST_EPOCH + RECORDS * 900;
+
+  // The whole log, before and after it, inside the head sector
+  CheckRange (0, 0xFFFFFFFF);
+  CheckRange (0, FIRST_EPOCH - 1);
+  CheckRange (endEpoch, 0xFFFFFFFF);
+  CheckRange (headFirstEpoch, 0xFFFFFFFF);
+  CheckRange (headFirstEpoch + 1, headFirstEpoch + 20000);
+  CheckRange (headFirstEpoch - 1, headFirstEpoch + 1);
+  CheckRange (firstEpoch, firstEpoch);
+  ranges += 7;
+
+  // Ranges from the edge of one sector to the edge of another, and one second around
+  for (uint32_t first = oldest; first <= newest; first++)
+  {
+    uint32_t last = first + rand () % (newest - first + 1);
+    uint32_t rangeStart, rangeEnd, unused;
+
+    SectorEpochs (first, &rangeStart, &unused);
+    SectorEpochs (last, &unused, &rangeEnd);
+    if (last == newest) rangeEnd = endEpoch;
+    for (int32_t startShift = -1; startShift <= 1; startShift++)
+      for (int32_t endShift = -1; endShift <= 1; endShift++)
+      {
+	CheckRange (rangeStart + startShift, rangeEnd + endShift);
+	ranges++;
+      }
+  }
+
+  // Random ranges
+  for (uint32_t i = 0; i < RANDOM_RANGES; i++)
+  {
+    uint32_t a = FIRST_EPOCH - 10000 + (uint32_t) rand () % (endEpoch - FIRST_EPOCH + 20000);
+    uint32_t b = FIRST_EPOCH - 10000 + (uint32_t) rand () % (endEpoch - FIRST_EPOCH + 20000);
+
+    CheckRange (a < b ? a : b, a < b ? b : a);
+    ranges++;
+  }
+
+  // Records appended later reach the head summary and a newly closed footer
+  AppendRecords (RECORDS / 10);
+  CheckRange (0, 0xFFFFFFFF);
+  CheckRange (headFirstEpoch, 0xFFFFFFFF);
+  ranges += 2;
+
+  // Whole sectors come from their footers: two cached pages read per sector instead of 16
+  start = FlashSim_GetTimeNs ();
+  SLOG_GetStats (0, 0xFFFFFFFF, &stats);
+  statsTime = FlashSim_GetTimeNs () - start;
+  memset (&reference, 0, sizeof(reference));
+  start = FlashSim_GetTimeNs ();
+  SLOG_ReadRange (0, 0xFFFFFFFF, CollectRecord, &reference);
+  readTime = FlashSim_GetTimeNs () - start;
+  CHECK(statsTime * 4 < readTime);
+  CHECK(SLOG_GetSequenceRange (&oldest, &newest));
+
+  FlashSim_Close ();
+  unlink (SIM_FILE);
+  printf ("sample log stats test passed: %u records in %u sectors, %u ranges, whole log %llu us with the footers,"
+	  " %llu us decoded\n", stats.count, newest - oldest + 1, ranges, (unsigned long long) statsTime / 1000,
+	  (unsigned long long) readTime / 1000);
+  return 0;
+}